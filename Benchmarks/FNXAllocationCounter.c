@@ -0,0 +1,67 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "FNXAllocationCounter.h"
+
+
+static _Atomic uint64_t FNXAllocations = 0;
+
+#if defined(__GLIBC__)
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+// Definitions in the executable take precedence over the ones in libc for every library the process loads.
+
+void *malloc(size_t size)
+{
+    atomic_fetch_add_explicit(&FNXAllocations, 1, memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    atomic_fetch_add_explicit(&FNXAllocations, 1, memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    atomic_fetch_add_explicit(&FNXAllocations, 1, memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+
+bool FNXAllocationCountingAvailable(void)
+{
+    return true;
+}
+
+#else
+
+bool FNXAllocationCountingAvailable(void)
+{
+    return false;
+}
+
+#endif
+
+uint64_t FNXAllocationCount(void)
+{
+    return atomic_load_explicit(&FNXAllocations, memory_order_relaxed);
+}
@@ -0,0 +1,32 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#ifndef FNXAllocationCounter_h
+#define FNXAllocationCounter_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// Counts the calls to malloc, calloc and realloc made by the whole process.
+// Counting works by interposing those functions, which is only supported on glibc. Elsewhere
+// FNXAllocationCountingAvailable returns false and the count stays at 0.
+
+bool FNXAllocationCountingAvailable(void);
+
+uint64_t FNXAllocationCount(void);
+
+#endif
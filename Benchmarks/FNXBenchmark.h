@@ -0,0 +1,42 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import <Foundation/Foundation.h>
+
+
+// Times a block and records the result, along with the allocations a call makes and how much the resident set grows
+// across a call, so that a set of measurements can be written out as JSON.
+@interface FNXBenchmark : NSObject
+
+// The minimum wall-clock time spent timing each measurement. Defaults to 0.1 seconds.
+@property (nonatomic, assign) NSTimeInterval minimumTime;
+
+// The measurements recorded so far, in the order they were made.
+@property (nonatomic, strong, readonly) NSArray *results;
+
+// Times block, which performs operation once on a collection of size elements, and records the measurement.
+// variant tells apart the implementations of an operation, e.g. @"fnx" and @"loop".
+// If block returns an NSEnumerator it is drained, so that lazy results are paid for.
+- (void)measureOperation:(NSString *)operation
+              collection:(NSString *)collection
+                    size:(NSUInteger)size
+                 variant:(NSString *)variant
+                   block:(id (^)(void))block;
+
+// Returns the measurements and a description of the host as JSON.
+- (NSData *)JSONData;
+
+@end
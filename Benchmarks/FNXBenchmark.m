@@ -0,0 +1,178 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import "FNXBenchmark.h"
+#import "FNXAllocationCounter.h"
+#include <time.h>
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <unistd.h>
+#endif
+
+
+// Aim for samples at least this long so that the clock's resolution doesn't matter.
+static const uint64_t FNXNanosecondsPerSecond = 1000000000;
+static const uint64_t FNXMinimumSampleNanoseconds = 1000000;
+static const NSUInteger FNXMinimumSamples = 5;
+
+static uint64_t FNXNow(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * FNXNanosecondsPerSecond + (uint64_t)ts.tv_nsec;
+}
+
+// The current, not the peak, resident set size of the process, or 0 when it can't be read.
+static uint64_t FNXResidentSetBytes(void)
+{
+#if defined(__APPLE__)
+    struct mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (KERN_SUCCESS != task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count)) {
+        return 0;
+    }
+    return (uint64_t)info.resident_size;
+#else
+    // The second field of /proc/self/statm is the resident set in pages.
+    unsigned long long size = 0;
+    unsigned long long resident = 0;
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (NULL == statm) {
+        return 0;
+    }
+    int fields = fscanf(statm, "%llu %llu", &size, &resident);
+    fclose(statm);
+    return (2 == fields) ? (uint64_t)resident * (uint64_t)sysconf(_SC_PAGESIZE) : 0;
+#endif
+}
+
+static int FNXCompareDoubles(const void *lhs, const void *rhs)
+{
+    double a = *(const double *)lhs;
+    double b = *(const double *)rhs;
+    return (a > b) - (a < b);
+}
+
+
+@implementation FNXBenchmark
+{
+    NSMutableArray *_results;
+    // Keeps the result of each call alive so that the compiler can't discard the work.
+    id _sink;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _minimumTime = 0.1;
+        _results = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (NSArray *)results
+{
+    return [_results copy];
+}
+
+- (void)measureOperation:(NSString *)operation
+              collection:(NSString *)collection
+                    size:(NSUInteger)size
+                 variant:(NSString *)variant
+                   block:(id (^)(void))block
+{
+    // Warm up the caches and the method caches, and find out roughly how long a call takes. The resident set growth
+    // across this first call, with its result still held by _sink, is the memory it touched beyond what the process
+    // already had resident; a process-wide peak would only report the largest operation measured so far.
+    uint64_t residentBefore = FNXResidentSetBytes();
+    uint64_t start = FNXNow();
+    [self callBlock:block];
+    uint64_t warmUp = MAX(FNXNow() - start, (uint64_t)1);
+    int64_t residentGrowth = (int64_t)FNXResidentSetBytes() - (int64_t)residentBefore;
+
+    uint64_t allocationsBefore = FNXAllocationCount();
+    [self callBlock:block];
+    uint64_t allocations = FNXAllocationCount() - allocationsBefore;
+
+    NSUInteger callsPerSample = (NSUInteger)MAX((uint64_t)1, FNXMinimumSampleNanoseconds / warmUp);
+    uint64_t budget = (uint64_t)(self.minimumTime * FNXNanosecondsPerSecond);
+    NSUInteger capacity = 16;
+    NSUInteger samples = 0;
+    double *nanosecondsPerCall = malloc(capacity * sizeof(double));
+    uint64_t elapsed = 0;
+    while (samples < FNXMinimumSamples || elapsed < budget) {
+        uint64_t sampleStart = FNXNow();
+        for (NSUInteger i = 0; i < callsPerSample; ++i) {
+            [self callBlock:block];
+        }
+        uint64_t sample = FNXNow() - sampleStart;
+        if (samples == capacity) {
+            capacity *= 2;
+            nanosecondsPerCall = realloc(nanosecondsPerCall, capacity * sizeof(double));
+        }
+        nanosecondsPerCall[samples++] = (double)sample / callsPerSample;
+        elapsed += sample;
+    }
+    qsort(nanosecondsPerCall, samples, sizeof(double), FNXCompareDoubles);
+    double median = nanosecondsPerCall[samples / 2];
+    double fastest = nanosecondsPerCall[0];
+    free(nanosecondsPerCall);
+    _sink = nil;
+
+    [_results addObject:@{ @"operation": operation,
+                           @"collection": collection,
+                           @"size": @(size),
+                           @"variant": variant,
+                           @"calls": @(samples * callsPerSample),
+                           @"nsPerCall": @(median),
+                           @"nsPerElement": @(median / MAX(size, (NSUInteger)1)),
+                           @"fastestNsPerCall": @(fastest),
+                           @"allocationsPerCall": (FNXAllocationCountingAvailable() ? @(allocations) : [NSNull null]),
+                           @"rssGrowthBytes": @(residentGrowth) }];
+}
+
+- (void)callBlock:(id (^)(void))block
+{
+    @autoreleasepool {
+        id result = block();
+        if ([result isKindOfClass:[NSEnumerator class]]) {
+            NSUInteger count = 0;
+            for (id obj in result) {
+                (void)obj;
+                ++count;
+            }
+            result = @(count);
+        }
+        _sink = result;
+    }
+}
+
+- (NSData *)JSONData
+{
+    NSProcessInfo *processInfo = [NSProcessInfo processInfo];
+    NSDictionary *report = @{ @"date": [[NSDate date] description],
+                              @"host": processInfo.hostName,
+                              @"operatingSystem": processInfo.operatingSystemVersionString,
+                              @"processorCount": @(processInfo.activeProcessorCount),
+                              @"allocationCounting": @(FNXAllocationCountingAvailable()),
+                              @"minimumTime": @(self.minimumTime),
+                              @"results": self.results };
+    return [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:NULL];
+}
+
+@end
@@ -0,0 +1,465 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+// Times every FNXTraversableOnce and FNXTraversable operator on NSArray, NSOrderedSet, NSSet, NSEnumerator and
+// FNXOption, next to a hand-written for-in loop that computes the same result, and writes the measurements as JSON.
+//
+// Options, passed as NSUserDefaults arguments:
+//   -maxSize 10000000          largest collection size; sizes are the powers of ten from 10 up to this
+//   -minTime 0.1               seconds spent timing each measurement
+//   -operations count,map      only run these operators
+//   -collections NSArray,NSSet only run on these collection types
+//   -output results.json       write the JSON here instead of to standard output
+
+#import <Foundation/Foundation.h>
+#import "FunctionalExtensions.h"
+#import "FNXBenchmark.h"
+#import "FNXAllocationCounter.h"
+
+
+// An operator together with a hand-written loop that computes the same result.
+@interface FNXBenchmarkOperation : NSObject
+
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, copy) id (^fnx)(id receiver, NSUInteger size);
+@property (nonatomic, copy) id (^loop)(id<NSFastEnumeration> elements, NSUInteger size);
+
++ (instancetype)operationWithName:(NSString *)name
+                              fnx:(id (^)(id receiver, NSUInteger size))fnx
+                             loop:(id (^)(id<NSFastEnumeration> elements, NSUInteger size))loop;
+
+@end
+
+
+@implementation FNXBenchmarkOperation
+
++ (instancetype)operationWithName:(NSString *)name
+                              fnx:(id (^)(id receiver, NSUInteger size))fnx
+                             loop:(id (^)(id<NSFastEnumeration> elements, NSUInteger size))loop
+{
+    FNXBenchmarkOperation *result = [[self alloc] init];
+    result.name = name;
+    result.fnx = fnx;
+    result.loop = loop;
+    return result;
+}
+
+@end
+
+
+// A collection type under test. receiver returns the object the operator is invoked on and elements returns what
+// the hand-written loop iterates over. Both are called before every call since enumerators can only be used once.
+@interface FNXBenchmarkCollection : NSObject
+
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, copy) id (^receiver)(void);
+@property (nonatomic, copy) id<NSFastEnumeration> (^elements)(void);
+
++ (instancetype)collectionWithName:(NSString *)name
+                          receiver:(id (^)(void))receiver
+                          elements:(id<NSFastEnumeration> (^)(void))elements;
+
+@end
+
+
+@implementation FNXBenchmarkCollection
+
++ (instancetype)collectionWithName:(NSString *)name
+                          receiver:(id (^)(void))receiver
+                          elements:(id<NSFastEnumeration> (^)(void))elements
+{
+    FNXBenchmarkCollection *result = [[self alloc] init];
+    result.name = name;
+    result.receiver = receiver;
+    result.elements = elements;
+    return result;
+}
+
+@end
+
+
+// The predicates are chosen so that the short-circuiting operators have to look at every element.
+static NSArray *FNXBenchmarkOperations(void)
+{
+    BOOL (^isOdd)(id) = ^BOOL(NSNumber *n) {
+        return (n.integerValue & 1) != 0;
+    };
+    BOOL (^isNegative)(id) = ^BOOL(NSNumber *n) {
+        return n.integerValue < 0;
+    };
+    BOOL (^isNonNegative)(id) = ^BOOL(NSNumber *n) {
+        return n.integerValue >= 0;
+    };
+
+    return @[
+        [FNXBenchmarkOperation operationWithName:@"count" fnx:^id(id receiver, NSUInteger size) {
+            return @([receiver fnx_count:isOdd]);
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSUInteger count = 0;
+            for (NSNumber *n in elements) {
+                if (n.integerValue & 1) {
+                    ++count;
+                }
+            }
+            return @(count);
+        }],
+        [FNXBenchmarkOperation operationWithName:@"exists" fnx:^id(id receiver, NSUInteger size) {
+            return @([receiver fnx_exists:isNegative]);
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            for (NSNumber *n in elements) {
+                if (n.integerValue < 0) {
+                    return @YES;
+                }
+            }
+            return @NO;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"find" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_find:isNegative];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            for (NSNumber *n in elements) {
+                if (n.integerValue < 0) {
+                    return [FNXSome someWithValue:n];
+                }
+            }
+            return [NSNull fnx_none];
+        }],
+        [FNXBenchmarkOperation operationWithName:@"foldLeft" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_foldLeftWithStartValue:@(0) op:^id(NSNumber *accumulator, NSNumber *n) {
+                return @(accumulator.integerValue + n.integerValue);
+            }];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSNumber *accumulator = @(0);
+            for (NSNumber *n in elements) {
+                accumulator = @(accumulator.integerValue + n.integerValue);
+            }
+            return accumulator;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"foldRight" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_foldRightWithStartValue:@(0) op:^id(NSNumber *n, NSNumber *accumulator) {
+                return @(accumulator.integerValue + n.integerValue);
+            }];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSMutableArray *buffer = [NSMutableArray array];
+            for (NSNumber *n in elements) {
+                [buffer addObject:n];
+            }
+            NSNumber *accumulator = @(0);
+            for (NSNumber *n in buffer.reverseObjectEnumerator) {
+                accumulator = @(accumulator.integerValue + n.integerValue);
+            }
+            return accumulator;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"forall" fnx:^id(id receiver, NSUInteger size) {
+            return @([receiver fnx_forall:isNonNegative]);
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            for (NSNumber *n in elements) {
+                if (n.integerValue < 0) {
+                    return @NO;
+                }
+            }
+            return @YES;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"foreach" fnx:^id(id receiver, NSUInteger size) {
+            __block NSInteger sum = 0;
+            [receiver fnx_foreach:^(NSNumber *n) {
+                sum += n.integerValue;
+            }];
+            return @(sum);
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSInteger sum = 0;
+            for (NSNumber *n in elements) {
+                sum += n.integerValue;
+            }
+            return @(sum);
+        }],
+        [FNXBenchmarkOperation operationWithName:@"isEmpty" fnx:^id(id receiver, NSUInteger size) {
+            return @([receiver fnx_isEmpty]);
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            for (id obj in elements) {
+                (void)obj;
+                return @NO;
+            }
+            return @YES;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"size" fnx:^id(id receiver, NSUInteger size) {
+            return @([receiver fnx_size]);
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSUInteger count = 0;
+            for (id obj in elements) {
+                (void)obj;
+                ++count;
+            }
+            return @(count);
+        }],
+        [FNXBenchmarkOperation operationWithName:@"toArray" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_toArray];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSMutableArray *result = [NSMutableArray array];
+            for (id obj in elements) {
+                [result addObject:obj];
+            }
+            return result;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"drop" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_drop:size / 2];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSMutableArray *result = [NSMutableArray array];
+            NSUInteger index = 0;
+            for (id obj in elements) {
+                if (index++ >= size / 2) {
+                    [result addObject:obj];
+                }
+            }
+            return result;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"filter" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_filter:isOdd];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSMutableArray *result = [NSMutableArray array];
+            for (NSNumber *n in elements) {
+                if (n.integerValue & 1) {
+                    [result addObject:n];
+                }
+            }
+            return result;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"filterNot" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_filterNot:isOdd];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSMutableArray *result = [NSMutableArray array];
+            for (NSNumber *n in elements) {
+                if (!(n.integerValue & 1)) {
+                    [result addObject:n];
+                }
+            }
+            return result;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"head" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_head];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            for (id obj in elements) {
+                return obj;
+            }
+            return nil;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"headOption" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_headOption];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            for (id obj in elements) {
+                return [FNXSome someWithValue:obj];
+            }
+            return [NSNull fnx_none];
+        }],
+        [FNXBenchmarkOperation operationWithName:@"init" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_init];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSMutableArray *result = [NSMutableArray array];
+            for (id obj in elements) {
+                [result addObject:obj];
+            }
+            [result removeLastObject];
+            return result;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"last" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_last];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            id last = nil;
+            for (id obj in elements) {
+                last = obj;
+            }
+            return last;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"lastOption" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_lastOption];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            id last = nil;
+            for (id obj in elements) {
+                last = obj;
+            }
+            if (last) {
+                return [FNXSome someWithValue:last];
+            } else {
+                return [NSNull fnx_none];
+            }
+        }],
+        [FNXBenchmarkOperation operationWithName:@"map" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_map:^id(NSNumber *n) {
+                return @(n.integerValue + 1);
+            }];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSMutableArray *result = [NSMutableArray array];
+            for (NSNumber *n in elements) {
+                [result addObject:@(n.integerValue + 1)];
+            }
+            return result;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"nonEmpty" fnx:^id(id receiver, NSUInteger size) {
+            return @([receiver fnx_nonEmpty]);
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            for (id obj in elements) {
+                (void)obj;
+                return @YES;
+            }
+            return @NO;
+        }],
+        [FNXBenchmarkOperation operationWithName:@"tail" fnx:^id(id receiver, NSUInteger size) {
+            return [receiver fnx_tail];
+        } loop:^id(id<NSFastEnumeration> elements, NSUInteger size) {
+            NSMutableArray *result = [NSMutableArray array];
+            BOOL first = YES;
+            for (id obj in elements) {
+                if (first) {
+                    first = NO;
+                } else {
+                    [result addObject:obj];
+                }
+            }
+            return result;
+        }],
+    ];
+}
+
+// Returns the collection types holding the numbers 0 to size - 1. FNXOption only takes part at size 1.
+static NSArray *FNXBenchmarkCollections(NSUInteger size)
+{
+    if (1 == size) {
+        FNXSome *some = [FNXSome someWithValue:@(0)];
+        NSArray *elements = @[@(0)];
+        return @[[FNXBenchmarkCollection collectionWithName:@"FNXOption" receiver:^id {
+            return some;
+        } elements:^id<NSFastEnumeration> {
+            return elements;
+        }]];
+    }
+
+    NSMutableArray *numbers = [NSMutableArray arrayWithCapacity:size];
+    for (NSUInteger i = 0; i < size; ++i) {
+        [numbers addObject:@(i)];
+    }
+    NSArray *array = [numbers copy];
+    NSOrderedSet *orderedSet = [NSOrderedSet orderedSetWithArray:array];
+    NSSet *set = [NSSet setWithArray:array];
+    return @[
+        [FNXBenchmarkCollection collectionWithName:@"NSArray" receiver:^id {
+            return array;
+        } elements:^id<NSFastEnumeration> {
+            return array;
+        }],
+        [FNXBenchmarkCollection collectionWithName:@"NSOrderedSet" receiver:^id {
+            return orderedSet;
+        } elements:^id<NSFastEnumeration> {
+            return orderedSet;
+        }],
+        [FNXBenchmarkCollection collectionWithName:@"NSSet" receiver:^id {
+            return set;
+        } elements:^id<NSFastEnumeration> {
+            return set;
+        }],
+        [FNXBenchmarkCollection collectionWithName:@"NSEnumerator" receiver:^id {
+            return array.objectEnumerator;
+        } elements:^id<NSFastEnumeration> {
+            return array.objectEnumerator;
+        }],
+    ];
+}
+
+// Returns the comma-separated names in the argument key, or nil if it wasn't passed.
+static NSSet *FNXBenchmarkNamesForKey(NSUserDefaults *defaults, NSString *key)
+{
+    NSString *names = [defaults stringForKey:key];
+    return names ? [NSSet setWithArray:[names componentsSeparatedByString:@","]] : nil;
+}
+
+int main(int argc, const char *argv[])
+{
+    @autoreleasepool {
+        NSUserDefaults *defaults = [NSUserDefaults standardUserDefaults];
+        [defaults registerDefaults:@{ @"maxSize": @(10000000), @"minTime": @(0.1) }];
+        NSUInteger maxSize = (NSUInteger)[defaults integerForKey:@"maxSize"];
+        NSSet *operationNames = FNXBenchmarkNamesForKey(defaults, @"operations");
+        NSSet *collectionNames = FNXBenchmarkNamesForKey(defaults, @"collections");
+
+        // Recording operator statistics slows the operators down a little, so the timings of such a run are only
+        // comparable to others made with -stats.
+        NSString *statsPath = [defaults stringForKey:@"stats"];
+        if (statsPath) {
+            if (![FNXStats isAvailable]) {
+                fprintf(stderr, "-stats needs the library built with FNX_INSTRUMENTATION=1\n");
+                return 1;
+            }
+            if (FNXAllocationCountingAvailable()) {
+                [FNXStats setAllocationCounter:FNXAllocationCount];
+            }
+            [FNXStats setEnabled:YES];
+        }
+
+        FNXBenchmark *benchmark = [[FNXBenchmark alloc] init];
+        benchmark.minimumTime = [defaults doubleForKey:@"minTime"];
+
+        NSArray *operations = [FNXBenchmarkOperations() fnx_filter:^BOOL(FNXBenchmarkOperation *operation) {
+            return nil == operationNames || [operationNames containsObject:operation.name];
+        }];
+        for (NSUInteger size = 1; size <= maxSize; size *= 10) {
+            // Release each size's collections before building the next ones.
+            @autoreleasepool {
+                NSArray *collections = [FNXBenchmarkCollections(size) fnx_filter:^BOOL(FNXBenchmarkCollection *collection) {
+                    return nil == collectionNames || [collectionNames containsObject:collection.name];
+                }];
+                for (FNXBenchmarkCollection *collection in collections) {
+                    for (FNXBenchmarkOperation *operation in operations) {
+                        fprintf(stderr, "%s %s %lu\n",
+                                collection.name.UTF8String, operation.name.UTF8String, (unsigned long)size);
+                        [benchmark measureOperation:operation.name
+                                         collection:collection.name
+                                               size:size
+                                            variant:@"fnx"
+                                              block:^id {
+                                                  return operation.fnx(collection.receiver(), size);
+                                              }];
+                        [benchmark measureOperation:operation.name
+                                         collection:collection.name
+                                               size:size
+                                            variant:@"loop"
+                                              block:^id {
+                                                  return operation.loop(collection.elements(), size);
+                                              }];
+                    }
+                }
+            }
+            if (size > NSUIntegerMax / 10) {
+                break;
+            }
+        }
+
+        NSData *json = [benchmark JSONData];
+        NSString *output = [defaults stringForKey:@"output"];
+        if (output) {
+            if (![json writeToFile:output atomically:YES]) {
+                fprintf(stderr, "Couldn't write %s\n", output.UTF8String);
+                return 1;
+            }
+        } else {
+            fwrite(json.bytes, 1, json.length, stdout);
+            fputc('\n', stdout);
+        }
+        NSError *error = nil;
+        if (statsPath && ![FNXStats writeSnapshotToJSONFile:statsPath error:&error]) {
+            fprintf(stderr, "Couldn't write %s: %s\n", statsPath.UTF8String, error.localizedDescription.UTF8String);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,29 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import <Foundation/Foundation.h>
+
+
+// An immutable array that presents a contiguous range of another immutable array, sharing its storage.
+// Creating a slice takes constant time and copies no elements. The slice keeps the whole underlying array alive, so
+// copy it into a plain NSArray if a small slice of a large array has to outlive the array.
+@interface FNXArraySlice : NSArray
+
+// Returns the elements of array in range. Slices of slices share the storage of the original array.
+// A mutable array is copied first so that the slice can't change under its holder.
++ (NSArray *)sliceWithArray:(NSArray *)array range:(NSRange)range;
+
+@end
@@ -0,0 +1,115 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import "FNXArraySlice.h"
+
+
+@implementation FNXArraySlice
+{
+    NSArray *_array;
+    NSUInteger _offset;
+    NSUInteger _count;
+}
+
++ (NSArray *)sliceWithArray:(NSArray *)array range:(NSRange)range
+{
+    NSParameterAssert(nil != array);
+    if (NSMaxRange(range) > array.count || NSMaxRange(range) < range.location) {
+        @throw [[NSException alloc] initWithName:NSRangeException
+                                          reason:NSLocalizedString(@"Slice out of bounds", @"Message when [FNXArraySlice sliceWithArray:range:] is called with a bad range")
+                                        userInfo:nil];
+    }
+    if (0 == range.length) {
+        return [NSArray array];
+    }
+    if ([array isKindOfClass:[FNXArraySlice class]]) {
+        FNXArraySlice *slice = (FNXArraySlice *)array;
+        return [[FNXArraySlice alloc] initWithArray:slice->_array
+                                             offset:slice->_offset + range.location
+                                              count:range.length];
+    }
+    // copy returns the array itself when it's already immutable.
+    return [[FNXArraySlice alloc] initWithArray:[array copy] offset:range.location count:range.length];
+}
+
+- (instancetype)initWithArray:(NSArray *)array offset:(NSUInteger)offset count:(NSUInteger)count
+{
+    self = [super init];
+    if (self) {
+        _array = array;
+        _offset = offset;
+        _count = count;
+    }
+    return self;
+}
+
+#pragma mark - NSArray
+
+- (NSUInteger)count
+{
+    return _count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+    if (index >= _count) {
+        @throw [[NSException alloc] initWithName:NSRangeException
+                                          reason:NSLocalizedString(@"Index out of bounds", @"Message when [FNXArraySlice objectAtIndex:] is called with a bad index")
+                                        userInfo:nil];
+    }
+    return [_array objectAtIndex:_offset + index];
+}
+
+- (void)getObjects:(id __unsafe_unretained [])objects range:(NSRange)range
+{
+    if (NSMaxRange(range) > _count || NSMaxRange(range) < range.location) {
+        @throw [[NSException alloc] initWithName:NSRangeException
+                                          reason:NSLocalizedString(@"Range out of bounds", @"Message when [FNXArraySlice getObjects:range:] is called with a bad range")
+                                        userInfo:nil];
+    }
+    [_array getObjects:objects range:NSMakeRange(_offset + range.location, range.length)];
+}
+
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    // Slices are immutable.
+    return self;
+}
+
+#pragma mark - NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(id __unsafe_unretained [])buffer
+                                    count:(NSUInteger)len
+{
+    NSUInteger index = state->state;
+    if (0 == index) {
+        // The slice can't be mutated, so point at a value that never changes.
+        state->mutationsPtr = &state->extra[0];
+    }
+    if (index >= _count) {
+        return 0;
+    }
+    NSUInteger batch = MIN(len, _count - index);
+    [_array getObjects:buffer range:NSMakeRange(_offset + index, batch)];
+    state->itemsPtr = buffer;
+    state->state = index + batch;
+    return batch;
+}
+
+@end
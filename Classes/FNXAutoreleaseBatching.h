@@ -0,0 +1,33 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Foundation/Foundation.h>
+
+
+// Controls the inner autorelease pools of the sequential NSArray operators that run a block over every element.
+// Without one, whatever the block autoreleases piles up until the caller's pool drains, which over millions of
+// elements can take far more memory than the results themselves. Draining a pool every few hundred or thousand
+// elements caps that at the temporaries of one batch, for the cost of a pool push and pop per batch.
+// The parallel operators always drain a pool per chunk; see FNXParallel.
+@interface FNXAutoreleaseBatching : NSObject
+
+// The number of elements after which fnx_map:, fnx_foreach:, fnx_foldLeftWithStartValue:op: and fnx_groupBy: drain
+// an inner autorelease pool. 0, the default, runs them without one.
++ (NSUInteger)defaultBatchSize;
+
+// Sets the number of elements after which the operators drain an inner autorelease pool, or 0 to not use one.
++ (void)setDefaultBatchSize:(NSUInteger)batchSize;
+
+@end
@@ -0,0 +1,122 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Foundation/Foundation.h>
+
+
+// An immutable, contiguous array of unboxed double values, for numeric work that shouldn't go through NSNumber.
+// The fnx_ operators mirror those of FNXTraversable with C-typed blocks. The kernels below run over the raw buffer
+// without any block invocations or message sends, in loops the compiler can vectorize.
+// Slices (fnx_drop:, fnx_init, fnx_tail) share the buffer of the array they were taken from.
+@interface FNXDoubleArray : NSObject <NSCopying>
+
+// The number of values.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+// The values, valid as long as this array is.
+@property (nonatomic, assign, readonly) const double *values;
+
+// Returns an array of a copy of count values.
++ (instancetype)arrayWithValues:(const double *)values count:(NSUInteger)count;
+
+// Returns an array of the doubleValue of each of numbers, converted in a single pass.
++ (instancetype)arrayWithNumbers:(NSArray *)numbers;
+
+// Returns the value at index. Raises NSRangeException if index is out of bounds.
+- (double)valueAtIndex:(NSUInteger)index;
+
+#pragma mark - Kernels
+
+// The dot product of this array and other. Raises NSInvalidArgumentException if they differ in length.
+- (double)dot:(FNXDoubleArray *)other;
+
+// The largest value. Raises if the array is empty.
+// NaN values give an unspecified result.
+- (double)max;
+
+// The smallest value. Raises if the array is empty.
+// NaN values give an unspecified result.
+- (double)min;
+
+// Returns the running sums of the values: the first value, the sum of the first two, and so on.
+- (FNXDoubleArray *)prefixSums;
+
+// Returns the values multiplied by factor.
+- (FNXDoubleArray *)scaledBy:(double)factor;
+
+// The sum of the values, 0 for an empty array.
+// The values are added in four interleaved lanes, so the result may differ in the last bits from a fold.
+- (double)sum;
+
+// Returns the values greater than threshold, in order.
+- (FNXDoubleArray *)valuesAbove:(double)threshold;
+
+#pragma mark - Operators
+
+// Counts the number of values which satisfy a predicate.
+- (NSUInteger)fnx_count:(BOOL (^)(double value))pred;
+
+// Selects all values except first n ones.
+- (FNXDoubleArray *)fnx_drop:(NSUInteger)n;
+
+// Tests whether a predicate holds for some of the values.
+- (BOOL)fnx_exists:(BOOL (^)(double value))pred;
+
+// Selects all values which satisfy a predicate.
+- (FNXDoubleArray *)fnx_filter:(BOOL (^)(double value))pred;
+
+// Selects all values which do not satisfy a predicate.
+- (FNXDoubleArray *)fnx_filterNot:(BOOL (^)(double value))pred;
+
+// Applies a binary operator to a start value and all values, going left to right.
+- (double)fnx_foldLeftWithStartValue:(double)startValue op:(double (^)(double accumulator, double value))op;
+
+// Applies a binary operator to all values and a start value, going right to left.
+- (double)fnx_foldRightWithStartValue:(double)startValue op:(double (^)(double value, double accumulator))op;
+
+// Tests whether a predicate holds for all values.
+- (BOOL)fnx_forall:(BOOL (^)(double value))pred;
+
+// Applies a function fn to all values.
+- (void)fnx_foreach:(void (^)(double value))fn;
+
+// Selects the first value. Raises if the array is empty.
+- (double)fnx_head;
+
+// Selects all values except the last. Raises if the array is empty.
+- (FNXDoubleArray *)fnx_init;
+
+// Tests whether this array is empty.
+- (BOOL)fnx_isEmpty;
+
+// Selects the last value. Raises if the array is empty.
+- (double)fnx_last;
+
+// Builds a new array by applying a function to all values.
+- (FNXDoubleArray *)fnx_map:(double (^)(double value))fn;
+
+// Tests whether this array is not empty.
+- (BOOL)fnx_nonEmpty;
+
+// The number of values.
+- (NSUInteger)fnx_size;
+
+// Selects all values except the first. Raises if the array is empty.
+- (FNXDoubleArray *)fnx_tail;
+
+// Converts this array to an array of NSNumber objects, in a single pass.
+- (NSArray *)fnx_toArray;
+
+@end
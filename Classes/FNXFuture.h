@@ -0,0 +1,97 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Foundation/Foundation.h>
+#import "FNXOption.h"
+
+
+// The error domain of the errors futures fail with on their own account.
+FOUNDATION_EXPORT NSString *const FNXFutureErrorDomain;
+
+typedef NS_ENUM(NSInteger, FNXFutureError) {
+    // The future was cancelled before it completed.
+    FNXFutureErrorCancelled = 1,
+    // The block computing the value returned nil.
+    FNXFutureErrorNoValue = 2
+};
+
+
+// The result of an asynchronous computation, which completes once, either with a value or with an error.
+// A completed future's result is an FNXSome holding the value, or an FNXNone if it failed; pending, it's nil.
+// Completion callbacks are invoked on the thread that completes the future, or on the calling thread if it has already
+// completed, so they should be quick; dispatch anything slow.
+@interface FNXFuture : NSObject
+
+// Whether the future has completed, successfully or not.
+@property (nonatomic, assign, readonly, getter=isCompleted) BOOL completed;
+
+// Whether the future failed because it was cancelled.
+@property (nonatomic, assign, readonly, getter=isCancelled) BOOL cancelled;
+
+// The value if the future completed successfully, an FNXNone if it failed, or nil while it's pending.
+@property (nonatomic, strong, readonly) id<FNXOption> result;
+
+// Why the future failed, or nil if it hasn't.
+@property (nonatomic, strong, readonly) NSError *error;
+
+// Returns a pending future, to be completed with completeWithValue: or failWithError:.
++ (instancetype)future;
+
+// Returns a future that has completed with value, which must not be nil.
++ (instancetype)futureWithValue:(id)value;
+
+// Returns a future that has failed with error.
++ (instancetype)futureWithError:(NSError *)error;
+
+// Returns a future completed with the value block returns when run on queue, or the default global queue if queue is
+// nil. If block returns nil the future fails with FNXFutureErrorNoValue. Cancelling the future before block starts
+// keeps it from running.
++ (instancetype)futureOnQueue:(dispatch_queue_t)queue block:(id (^)(void))block;
+
+// Returns a future of the array of the values of the futures fn returns for the elements of collection, in the order of
+// the elements. At most maxConcurrent of those futures are pending at once: the next element is only passed to fn when
+// one of them completes. The first failure fails the result, and no further elements are started.
+// Cancelling the result cancels the pending futures. Raises NSInvalidArgumentException if maxConcurrent is 0.
++ (FNXFuture *)futureByTraversing:(id<NSFastEnumeration>)collection
+                    maxConcurrent:(NSUInteger)maxConcurrent
+                               fn:(FNXFuture *(^)(id obj))fn;
+
+// Completes the future with value, which must not be nil. Returns NO if the future had already completed.
+- (BOOL)completeWithValue:(id)value;
+
+// Fails the future with error. Returns NO if the future had already completed.
+- (BOOL)failWithError:(NSError *)error;
+
+// Fails the future with FNXFutureErrorCancelled, unless it has already completed.
+- (void)cancel;
+
+// Registers a callback invoked with the result once the future completes.
+- (void)onComplete:(void (^)(id<FNXOption> result))callback;
+
+// Blocks the calling thread until the future completes, and returns its result. Must not be called on a serial queue
+// the future needs to run on.
+- (id<FNXOption>)waitForResult;
+
+// Blocks the calling thread until the future completes or timeout seconds have passed, and returns its result, or nil
+// on timeout.
+- (id<FNXOption>)waitForResultWithTimeout:(NSTimeInterval)timeout;
+
+// Returns a future of fn applied to the value of this future, or failing with its error. fn must not return nil.
+- (FNXFuture *)fnx_map:(id (^)(id value))fn;
+
+// Returns the future fn returns for the value of this future, or one failing with its error.
+- (FNXFuture *)fnx_flatMap:(FNXFuture *(^)(id value))fn;
+
+@end
@@ -0,0 +1,402 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import "FNXFuture.h"
+#import "FNXSome.h"
+#import "FNXNone.h"
+
+
+NSString *const FNXFutureErrorDomain = @"FNXFutureErrorDomain";
+
+
+@interface FNXFuture ()
+{
+    NSCondition *_condition;
+    // The callbacks waiting for completion; nil once the future has completed.
+    NSMutableArray *_callbacks;
+    id<FNXOption> _result;
+    NSError *_error;
+}
+@end
+
+
+// The state of a traversal started by [FNXFuture futureByTraversing:maxConcurrent:fn:].
+// Elements are started by a single launch loop at a time. An element completing while the loop runs only records its
+// value, and the loop picks up the freed slot; otherwise the completing thread runs the loop itself. Futures that
+// complete synchronously therefore don't recurse.
+@interface FNXTraversal : NSObject
+{
+    NSLock *_lock;
+    id<NSFastEnumeration> _collection;
+    NSFastEnumerationState _state;
+    __unsafe_unretained id _buffer[16];
+    // The last batch of elements handed out by the collection. A generic NSEnumerator only keeps them alive in the
+    // autorelease pool of the thread that asked, which may drain before they're all started, so they're retained here.
+    NSArray *_batch;
+    NSUInteger _position;
+    NSUInteger _maxConcurrent;
+    FNXFuture *(^_fn)(id obj);
+    FNXFuture *_result;
+    NSMutableArray *_values;
+    // The futures still pending, by the index of their element.
+    NSMutableDictionary *_pending;
+    BOOL _exhausted;
+    BOOL _finished;
+    BOOL _launching;
+}
+
+- (instancetype)initWithCollection:(id<NSFastEnumeration>)collection
+                     maxConcurrent:(NSUInteger)maxConcurrent
+                                fn:(FNXFuture *(^)(id obj))fn;
+
+- (FNXFuture *)start;
+
+@end
+
+
+static NSError *FNXFutureErrorWithCode(FNXFutureError code)
+{
+    return [NSError errorWithDomain:FNXFutureErrorDomain code:code userInfo:nil];
+}
+
+@implementation FNXFuture
+
++ (instancetype)future
+{
+    return [[self alloc] init];
+}
+
++ (instancetype)futureWithValue:(id)value
+{
+    FNXFuture *result = [self future];
+    [result completeWithValue:value];
+    return result;
+}
+
++ (instancetype)futureWithError:(NSError *)error
+{
+    FNXFuture *result = [self future];
+    [result failWithError:error];
+    return result;
+}
+
++ (instancetype)futureOnQueue:(dispatch_queue_t)queue block:(id (^)(void))block
+{
+    NSParameterAssert(nil != block);
+    FNXFuture *result = [self future];
+    dispatch_async(queue ?: dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        if (result.completed) {
+            return;
+        }
+        id value = block();
+        if (nil != value) {
+            [result completeWithValue:value];
+        } else {
+            [result failWithError:FNXFutureErrorWithCode(FNXFutureErrorNoValue)];
+        }
+    });
+    return result;
+}
+
++ (FNXFuture *)futureByTraversing:(id<NSFastEnumeration>)collection
+                    maxConcurrent:(NSUInteger)maxConcurrent
+                               fn:(FNXFuture *(^)(id obj))fn
+{
+    NSParameterAssert(nil != fn);
+    if (0 == maxConcurrent) {
+        @throw [[NSException alloc] initWithName:NSInvalidArgumentException
+                                          reason:NSLocalizedString(@"Concurrency limit must be positive", @"Message when [FNXFuture futureByTraversing:maxConcurrent:fn:] is called with a limit of 0")
+                                        userInfo:nil];
+    }
+    return [[[FNXTraversal alloc] initWithCollection:collection maxConcurrent:maxConcurrent fn:fn] start];
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _condition = [[NSCondition alloc] init];
+        _callbacks = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (BOOL)isCompleted
+{
+    [_condition lock];
+    BOOL result = nil != _result;
+    [_condition unlock];
+    return result;
+}
+
+- (BOOL)isCancelled
+{
+    NSError *error = self.error;
+    return [error.domain isEqualToString:FNXFutureErrorDomain] && FNXFutureErrorCancelled == error.code;
+}
+
+- (id<FNXOption>)result
+{
+    [_condition lock];
+    id<FNXOption> result = _result;
+    [_condition unlock];
+    return result;
+}
+
+- (NSError *)error
+{
+    [_condition lock];
+    NSError *error = _error;
+    [_condition unlock];
+    return error;
+}
+
+// Records the result and invokes the callbacks, outside the lock so they may use the future.
+- (BOOL)completeWithResult:(id<FNXOption>)result error:(NSError *)error
+{
+    [_condition lock];
+    if (nil != _result) {
+        [_condition unlock];
+        return NO;
+    }
+    _result = result;
+    _error = error;
+    NSArray *callbacks = _callbacks;
+    _callbacks = nil;
+    [_condition broadcast];
+    [_condition unlock];
+    for (void (^callback)(id<FNXOption>) in callbacks) {
+        callback(result);
+    }
+    return YES;
+}
+
+- (BOOL)completeWithValue:(id)value
+{
+    NSParameterAssert(nil != value);
+    return [self completeWithResult:[FNXSome someWithValue:value] error:nil];
+}
+
+- (BOOL)failWithError:(NSError *)error
+{
+    NSParameterAssert(nil != error);
+    return [self completeWithResult:[NSNull fnx_none] error:error];
+}
+
+- (void)cancel
+{
+    [self failWithError:FNXFutureErrorWithCode(FNXFutureErrorCancelled)];
+}
+
+- (void)onComplete:(void (^)(id<FNXOption> result))callback
+{
+    NSParameterAssert(nil != callback);
+    [_condition lock];
+    id<FNXOption> result = _result;
+    if (nil == result) {
+        [_callbacks addObject:[callback copy]];
+    }
+    [_condition unlock];
+    if (nil != result) {
+        callback(result);
+    }
+}
+
+- (id<FNXOption>)waitForResult
+{
+    [_condition lock];
+    while (nil == _result) {
+        [_condition wait];
+    }
+    id<FNXOption> result = _result;
+    [_condition unlock];
+    return result;
+}
+
+- (id<FNXOption>)waitForResultWithTimeout:(NSTimeInterval)timeout
+{
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:timeout];
+    [_condition lock];
+    while (nil == _result && [_condition waitUntilDate:deadline]) {
+    }
+    id<FNXOption> result = _result;
+    [_condition unlock];
+    return result;
+}
+
+- (FNXFuture *)fnx_map:(id (^)(id value))fn
+{
+    NSParameterAssert(nil != fn);
+    return [self fnx_flatMap:^FNXFuture *(id value) {
+        id mapped = fn(value);
+        return nil != mapped ? [FNXFuture futureWithValue:mapped] : [FNXFuture futureWithError:FNXFutureErrorWithCode(FNXFutureErrorNoValue)];
+    }];
+}
+
+- (FNXFuture *)fnx_flatMap:(FNXFuture *(^)(id value))fn
+{
+    NSParameterAssert(nil != fn);
+    FNXFuture *result = [FNXFuture future];
+    // The callbacks retain the futures they read the error of; they're released once those complete.
+    [self onComplete:^(id<FNXOption> option) {
+        if (!option.fnx_isDefined) {
+            [result failWithError:self.error];
+            return;
+        }
+        FNXFuture *next = fn(option.fnx_get);
+        [next onComplete:^(id<FNXOption> nextOption) {
+            if (nextOption.fnx_isDefined) {
+                [result completeWithValue:nextOption.fnx_get];
+            } else {
+                [result failWithError:next.error];
+            }
+        }];
+    }];
+    return result;
+}
+
+- (NSString *)description
+{
+    id<FNXOption> result = self.result;
+    if (nil == result) {
+        return [NSString stringWithFormat:@"<%@ %p: pending>", [self class], self];
+    }
+    return [NSString stringWithFormat:@"<%@ %p: %@>", [self class], self, result.fnx_isDefined ? result.fnx_get : self.error];
+}
+
+@end
+
+
+@implementation FNXTraversal
+
+- (instancetype)initWithCollection:(id<NSFastEnumeration>)collection
+                     maxConcurrent:(NSUInteger)maxConcurrent
+                                fn:(FNXFuture *(^)(id obj))fn
+{
+    self = [super init];
+    if (self) {
+        _lock = [[NSLock alloc] init];
+        _collection = collection;
+        _maxConcurrent = maxConcurrent;
+        _fn = [fn copy];
+        _result = [FNXFuture future];
+        _values = [NSMutableArray array];
+        _pending = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (FNXFuture *)start
+{
+    // A failed or cancelled result stops the traversal and cancels whatever is still pending.
+    [_result onComplete:^(id<FNXOption> result) {
+        [_lock lock];
+        _finished = YES;
+        NSArray *pending = _pending.allValues;
+        [_pending removeAllObjects];
+        [_lock unlock];
+        for (FNXFuture *future in pending) {
+            [future cancel];
+        }
+    }];
+    FNXFuture *result = _result;
+    [_lock lock];
+    _launching = YES;
+    [_lock unlock];
+    [self launch];
+    return result;
+}
+
+// Pulls the next element from the collection. Must be called with the lock held.
+- (id)nextObject
+{
+    if (_position == _batch.count) {
+        NSUInteger available = [_collection countByEnumeratingWithState:&_state objects:_buffer count:16];
+        _batch = [NSArray arrayWithObjects:_state.itemsPtr count:available];
+        _position = 0;
+        if (0 == available) {
+            return nil;
+        }
+    }
+    return _batch[_position++];
+}
+
+// Starts elements until maxConcurrent of them are pending or the collection is exhausted, then completes the result
+// if nothing is left pending. The caller must have set _launching.
+- (void)launch
+{
+    for (;;) {
+        [_lock lock];
+        id obj = nil;
+        NSUInteger index = 0;
+        if (!_finished && !_exhausted && _pending.count < _maxConcurrent) {
+            obj = [self nextObject];
+            if (nil == obj) {
+                _exhausted = YES;
+            } else {
+                index = _values.count;
+                [_values addObject:[NSNull null]];
+            }
+        }
+        if (nil == obj) {
+            _launching = NO;
+            BOOL done = !_finished && _exhausted && 0 == _pending.count;
+            NSArray *values = done ? [_values copy] : nil;
+            [_lock unlock];
+            if (done) {
+                [_result completeWithValue:values];
+            }
+            return;
+        }
+        [_lock unlock];
+
+        FNXFuture *future = _fn(obj) ?: [FNXFuture futureWithError:FNXFutureErrorWithCode(FNXFutureErrorNoValue)];
+        NSNumber *key = @(index);
+        [_lock lock];
+        if (_finished) {
+            [_lock unlock];
+            [future cancel];
+            return;
+        }
+        _pending[key] = future;
+        [_lock unlock];
+        [future onComplete:^(id<FNXOption> result) {
+            [self future:future atIndex:index completedWithResult:result];
+        }];
+    }
+}
+
+- (void)future:(FNXFuture *)future atIndex:(NSUInteger)index completedWithResult:(id<FNXOption>)result
+{
+    if (!result.fnx_isDefined) {
+        [_result failWithError:future.error];
+        return;
+    }
+    [_lock lock];
+    if (_finished) {
+        [_lock unlock];
+        return;
+    }
+    _values[index] = result.fnx_get;
+    [_pending removeObjectForKey:@(index)];
+    BOOL launch = !_launching;
+    _launching = YES;
+    [_lock unlock];
+    if (launch) {
+        [self launch];
+    }
+}
+
+@end
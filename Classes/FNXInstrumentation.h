@@ -0,0 +1,51 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+// Instrumentation hooks for the fnx_ operators; see FNXStats. Not part of the public interface.
+
+#import <Foundation/Foundation.h>
+#import "FNXStats.h"
+
+#if FNX_INSTRUMENTATION
+
+// Whether calls are being recorded; set through [FNXStats setEnabled:].
+FOUNDATION_EXPORT volatile BOOL FNXStatsRecording;
+
+// The state of one instrumented call, recorded when it goes out of scope.
+typedef struct {
+    SEL selector;
+    __unsafe_unretained Class collectionClass;
+    NSUInteger elements;
+    // The allocation counter in use when the call started, if any, and its count then.
+    FNXStatsAllocationCounter allocationCounter;
+    uint64_t allocationsAtStart;
+    uint64_t start;
+    BOOL active;
+} FNXStatsScope;
+
+FOUNDATION_EXPORT FNXStatsScope FNXStatsScopeBegin(SEL selector, Class collectionClass, NSUInteger elements);
+FOUNDATION_EXPORT void FNXStatsScopeEnd(FNXStatsScope *scope);
+
+// Records a call of the enclosing method as an operator of collectionClass over elementCount elements, when the method
+// returns. elementCount is only evaluated while recording.
+#define FNX_INSTRUMENT_OPERATOR(collectionClass, elementCount) \
+    __attribute__((cleanup(FNXStatsScopeEnd), unused)) FNXStatsScope fnx_statsScope = \
+        FNXStatsScopeBegin(_cmd, [collectionClass class], FNXStatsRecording ? (NSUInteger)(elementCount) : 0)
+
+#else
+
+#define FNX_INSTRUMENT_OPERATOR(collectionClass, elementCount) do {} while (0)
+
+#endif
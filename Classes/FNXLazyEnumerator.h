@@ -0,0 +1,127 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import <Foundation/Foundation.h>
+#import "FNXTraversable.h"
+
+
+// Base class for enumerators that lazily pull their elements from an upstream enumerator.
+// Subclasses only have to implement nextObject; fast enumeration is served in batches of at most one buffer, so a
+// pipeline of lazy enumerators over an unbounded source runs in constant memory.
+@interface FNXLazyEnumerator : NSEnumerator
+
+@property (nonatomic, strong, readonly) NSEnumerator *source;
+
+- (instancetype)initWithSource:(NSEnumerator *)source;
+
+// Returns the next element or nil when the enumeration is exhausted.
+// Abstract
+- (id)nextObject;
+
+@end
+
+
+// Lazily applies fn to every element of the source.
+@interface FNXMappingEnumerator : FNXLazyEnumerator
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source fn:(id (^)(id obj))fn;
+
+@end
+
+
+// Lazily selects the elements of the source which satisfy pred.
+@interface FNXFilteringEnumerator : FNXLazyEnumerator
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source pred:(BOOL (^)(id obj))pred;
+
+@end
+
+
+// Lazily skips the first n elements of the source.
+@interface FNXDroppingEnumerator : FNXLazyEnumerator
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source count:(NSUInteger)n;
+
+@end
+
+
+// Lazily selects the first n elements of the source, without pulling any further elements from it.
+@interface FNXTakingEnumerator : FNXLazyEnumerator
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source count:(NSUInteger)n;
+
+@end
+
+
+// Lazily selects all elements of the source except the last, by holding back one element.
+@interface FNXInitEnumerator : FNXLazyEnumerator
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source;
+
+@end
+
+
+// Lazily pairs up the elements of the source with those of another enumerator as FNXTuple2 objects.
+// The enumeration ends as soon as either enumerator is exhausted.
+@interface FNXZippingEnumerator : FNXLazyEnumerator
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source other:(NSEnumerator *)other;
+
+@end
+
+
+// Lazily applies fn to every element of the source and streams the elements of the resulting collections.
+@interface FNXFlatMappingEnumerator : FNXLazyEnumerator
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source fn:(id<FNXTraversableOnce> (^)(id obj))fn;
+
+@end
+
+
+// Lazily groups the elements of the source into arrays of up to size consecutive elements, starting every step
+// elements; the last one is shorter when the source runs out before filling it. Only the elements of the current
+// window are held, in a ring buffer.
+@interface FNXSlidingEnumerator : FNXLazyEnumerator
+
+// Raises NSInvalidArgumentException if size or step is 0.
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source size:(NSUInteger)size step:(NSUInteger)step;
+
+@end
+
+
+// Lazily produces the running accumulations of op over the source, starting with the start value.
+@interface FNXScanningEnumerator : FNXLazyEnumerator
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source startValue:(id)startValue op:(id (^)(id accumulator, id obj))op;
+
+@end
+
+
+// Applies fn to the elements of the source on a pool of worker threads, overlapping the work with whatever pulls from
+// this enumerator. A producer thread pulls the source in batches and hands them to the workers; the results come out
+// in the order of the source. At most bufferSize elements are held between the source and the consumer: when that
+// many are queued, in progress or waiting to be pulled, the producer blocks until the consumer catches up.
+// The threads are only started by the first nextObject, and stop once the source is exhausted or this enumerator is
+// deallocated. fn must be safe to call from several threads at once; nil results come out as [FNXNone none].
+@interface FNXPipeEnumerator : FNXLazyEnumerator
+
+// Raises NSInvalidArgumentException if workers or bufferSize is 0.
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source
+                                  fn:(id (^)(id obj))fn
+                             workers:(NSUInteger)workers
+                          bufferSize:(NSUInteger)bufferSize;
+
+@end
@@ -0,0 +1,613 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import "FNXLazyEnumerator.h"
+#import "FNXTuple2.h"
+#import "FNXNone.h"
+
+
+@implementation FNXLazyEnumerator
+{
+    // Keeps the elements handed out by the last fast enumeration batch alive, since the caller's buffer doesn't
+    // retain them.
+    NSMutableArray *_batch;
+}
+
+- (instancetype)initWithSource:(NSEnumerator *)source
+{
+    NSParameterAssert(nil != source);
+
+    self = [super init];
+    if (self) {
+        _source = source;
+    }
+    return self;
+}
+
+// Returns the next element or nil when the enumeration is exhausted.
+// Abstract
+- (id)nextObject
+{
+    [self doesNotRecognizeSelector:_cmd];
+    return nil;
+}
+
+#pragma mark - NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(id __unsafe_unretained [])buffer
+                                    count:(NSUInteger)len
+{
+    if (0 == state->state) {
+        state->state = 1;
+        // The enumerator can't be mutated, so point at a value that never changes.
+        state->mutationsPtr = &state->extra[0];
+        _batch = [NSMutableArray arrayWithCapacity:len];
+    }
+    [_batch removeAllObjects];
+    id obj = nil;
+    while (_batch.count < len && nil != (obj = [self nextObject])) {
+        [_batch addObject:obj];
+    }
+    [_batch getObjects:buffer range:NSMakeRange(0, _batch.count)];
+    state->itemsPtr = buffer;
+    return _batch.count;
+}
+
+@end
+
+
+@implementation FNXMappingEnumerator
+{
+    id (^_fn)(id obj);
+}
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source fn:(id (^)(id obj))fn
+{
+    NSParameterAssert(nil != fn);
+    FNXMappingEnumerator *result = [[FNXMappingEnumerator alloc] initWithSource:source];
+    result->_fn = [fn copy];
+    return result;
+}
+
+- (id)nextObject
+{
+    id obj = [self.source nextObject];
+    return (nil != obj) ? _fn(obj) : nil;
+}
+
+@end
+
+
+@implementation FNXFilteringEnumerator
+{
+    BOOL (^_pred)(id obj);
+}
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source pred:(BOOL (^)(id obj))pred
+{
+    NSParameterAssert(nil != pred);
+    FNXFilteringEnumerator *result = [[FNXFilteringEnumerator alloc] initWithSource:source];
+    result->_pred = [pred copy];
+    return result;
+}
+
+- (id)nextObject
+{
+    id obj = [self.source nextObject];
+    while (nil != obj && !_pred(obj)) {
+        obj = [self.source nextObject];
+    }
+    return obj;
+}
+
+@end
+
+
+@implementation FNXDroppingEnumerator
+{
+    NSUInteger _remaining;
+}
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source count:(NSUInteger)n
+{
+    FNXDroppingEnumerator *result = [[FNXDroppingEnumerator alloc] initWithSource:source];
+    result->_remaining = n;
+    return result;
+}
+
+- (id)nextObject
+{
+    while (_remaining > 0) {
+        --_remaining;
+        if (nil == [self.source nextObject]) {
+            _remaining = 0;
+            return nil;
+        }
+    }
+    return [self.source nextObject];
+}
+
+@end
+
+
+@implementation FNXTakingEnumerator
+{
+    NSUInteger _remaining;
+}
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source count:(NSUInteger)n
+{
+    FNXTakingEnumerator *result = [[FNXTakingEnumerator alloc] initWithSource:source];
+    result->_remaining = n;
+    return result;
+}
+
+- (id)nextObject
+{
+    if (0 == _remaining) {
+        return nil;
+    }
+    --_remaining;
+    id obj = [self.source nextObject];
+    if (nil == obj) {
+        _remaining = 0;
+    }
+    return obj;
+}
+
+@end
+
+
+@implementation FNXInitEnumerator
+{
+    id _previous;
+}
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source
+{
+    return [[FNXInitEnumerator alloc] initWithSource:source];
+}
+
+- (id)nextObject
+{
+    if (nil == _previous) {
+        _previous = [self.source nextObject];
+    }
+    id obj = [self.source nextObject];
+    if (nil == obj) {
+        _previous = nil;
+        return nil;
+    }
+    id result = _previous;
+    _previous = obj;
+    return result;
+}
+
+@end
+
+
+@implementation FNXZippingEnumerator
+{
+    NSEnumerator *_other;
+}
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source other:(NSEnumerator *)other
+{
+    NSParameterAssert(nil != other);
+    FNXZippingEnumerator *result = [[FNXZippingEnumerator alloc] initWithSource:source];
+    result->_other = other;
+    return result;
+}
+
+- (id)nextObject
+{
+    id first = [self.source nextObject];
+    if (nil == first) {
+        return nil;
+    }
+    id second = [_other nextObject];
+    if (nil == second) {
+        return nil;
+    }
+    return [FNXTuple2 tuple2With_1:first _2:second];
+}
+
+@end
+
+
+@implementation FNXFlatMappingEnumerator
+{
+    id<FNXTraversableOnce> (^_fn)(id obj);
+    NSEnumerator *_inner;
+}
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source fn:(id<FNXTraversableOnce> (^)(id obj))fn
+{
+    NSParameterAssert(nil != fn);
+    FNXFlatMappingEnumerator *result = [[FNXFlatMappingEnumerator alloc] initWithSource:source];
+    result->_fn = [fn copy];
+    return result;
+}
+
+- (id)nextObject
+{
+    id obj = [_inner nextObject];
+    while (nil == obj) {
+        id outer = [self.source nextObject];
+        if (nil == outer) {
+            _inner = nil;
+            return nil;
+        }
+        id<FNXTraversableOnce> traversable = _fn(outer);
+        // Stream enumerators and iterables directly instead of forcing them into an array.
+        if ([traversable isKindOfClass:[NSEnumerator class]]) {
+            _inner = (NSEnumerator *)traversable;
+        } else if ([traversable conformsToProtocol:@protocol(FNXIterable)]) {
+            _inner = [(id<FNXIterable>)traversable fnx_iterator];
+        } else {
+            _inner = traversable.fnx_toArray.objectEnumerator;
+        }
+        obj = [_inner nextObject];
+    }
+    return obj;
+}
+
+@end
+
+
+@implementation FNXSlidingEnumerator
+{
+    NSUInteger _size;
+    NSUInteger _step;
+    // The elements of the current window, oldest first from _start.
+    __strong id *_ring;
+    NSUInteger _start;
+    NSUInteger _filled;
+    BOOL _started;
+    BOOL _exhausted;
+}
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source size:(NSUInteger)size step:(NSUInteger)step
+{
+    if (0 == size || 0 == step) {
+        @throw [[NSException alloc] initWithName:NSInvalidArgumentException
+                                          reason:NSLocalizedString(@"Window size and step must be positive", @"Message when [FNXSlidingEnumerator enumeratorWithSource:size:step:] is called with a size or step of 0")
+                                        userInfo:nil];
+    }
+    FNXSlidingEnumerator *result = [[FNXSlidingEnumerator alloc] initWithSource:source];
+    result->_size = size;
+    result->_step = step;
+    result->_ring = (__strong id *)calloc(size, sizeof(id));
+    return result;
+}
+
+- (void)dealloc
+{
+    [self clearRing];
+    free(_ring);
+}
+
+- (void)clearRing
+{
+    for (NSUInteger i = 0; i < _filled; ++i) {
+        _ring[(_start + i) % _size] = nil;
+    }
+    _start = 0;
+    _filled = 0;
+}
+
+// Pulls elements from the source until the window is full. Returns the number of elements pulled.
+- (NSUInteger)fillRing
+{
+    NSUInteger pulled = 0;
+    while (_filled < _size) {
+        id obj = [self.source nextObject];
+        if (nil == obj) {
+            _exhausted = YES;
+            break;
+        }
+        _ring[(_start + _filled) % _size] = obj;
+        _filled += 1;
+        pulled += 1;
+    }
+    return pulled;
+}
+
+- (id)nextObject
+{
+    if (_exhausted) {
+        [self clearRing];
+        return nil;
+    }
+    if (!_started) {
+        _started = YES;
+    } else if (_step < _size) {
+        // Slide the window: forget the oldest step elements, keeping the overlap with the next window.
+        for (NSUInteger i = 0; i < _step; ++i) {
+            _ring[(_start + i) % _size] = nil;
+        }
+        _start = (_start + _step) % _size;
+        _filled -= _step;
+    } else {
+        // The windows don't overlap, so skip the elements between them.
+        [self clearRing];
+        for (NSUInteger i = _size; i < _step; ++i) {
+            if (nil == [self.source nextObject]) {
+                _exhausted = YES;
+                return nil;
+            }
+        }
+    }
+    // A window that adds no elements to those already emitted isn't emitted.
+    if (0 == [self fillRing]) {
+        _exhausted = YES;
+        [self clearRing];
+        return nil;
+    }
+    __unsafe_unretained id *window = (__unsafe_unretained id *)malloc(_filled * sizeof(id));
+    for (NSUInteger i = 0; i < _filled; ++i) {
+        window[i] = _ring[(_start + i) % _size];
+    }
+    NSArray *result = [NSArray arrayWithObjects:window count:_filled];
+    free(window);
+    return result;
+}
+
+@end
+
+
+@implementation FNXScanningEnumerator
+{
+    id (^_op)(id accumulator, id obj);
+    id _accumulator;
+    BOOL _started;
+}
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source startValue:(id)startValue op:(id (^)(id accumulator, id obj))op
+{
+    NSParameterAssert(nil != startValue);
+    NSParameterAssert(nil != op);
+    FNXScanningEnumerator *result = [[FNXScanningEnumerator alloc] initWithSource:source];
+    result->_op = [op copy];
+    result->_accumulator = startValue;
+    return result;
+}
+
+- (id)nextObject
+{
+    if (!_started) {
+        _started = YES;
+        return _accumulator;
+    }
+    if (nil == _accumulator) {
+        return nil;
+    }
+    id obj = [self.source nextObject];
+    // Only the latest accumulation is kept, and it's released once the source is exhausted.
+    _accumulator = (nil != obj) ? _op(_accumulator, obj) : nil;
+    return _accumulator;
+}
+
+@end
+
+
+// A batch of source elements and, once a worker has processed it, their results.
+@interface FNXPipeBatch : NSObject
+
+@property (nonatomic, strong) NSArray *inputs;
+@property (nonatomic, strong) NSArray *outputs;
+
+@end
+
+@implementation FNXPipeBatch
+@end
+
+
+// The state shared by a pipe's producer, workers and consumer, guarded by its condition. It's kept apart from the
+// enumerator so the threads don't keep the enumerator alive, and can be told to stop when it goes away.
+@interface FNXPipeState : NSObject
+{
+@package
+    NSCondition *_condition;
+    NSEnumerator *_source;
+    id (^_fn)(id obj);
+    NSUInteger _batchSize;
+    NSUInteger _maxBatches;
+    // The batches waiting for a worker, oldest first.
+    NSMutableArray *_queued;
+    // All the batches the consumer hasn't pulled yet, in source order.
+    NSMutableArray *_ordered;
+    // The number of batches produced and not yet fully consumed.
+    NSUInteger _inFlight;
+    BOOL _exhausted;
+    BOOL _cancelled;
+}
+
+- (void)produce;
+- (void)work;
+
+@end
+
+@implementation FNXPipeState
+
+- (void)produce
+{
+    for (;;) {
+        [_condition lock];
+        while (_inFlight >= _maxBatches && !_cancelled) {
+            [_condition wait];
+        }
+        BOOL cancelled = _cancelled;
+        [_condition unlock];
+        if (cancelled) {
+            break;
+        }
+
+        // The source is only ever read on this thread, outside the lock.
+        NSMutableArray *inputs = [NSMutableArray arrayWithCapacity:_batchSize];
+        @autoreleasepool {
+            id obj;
+            while (inputs.count < _batchSize && nil != (obj = [_source nextObject])) {
+                [inputs addObject:obj];
+            }
+        }
+        BOOL exhausted = inputs.count < _batchSize;
+
+        [_condition lock];
+        if (inputs.count > 0) {
+            FNXPipeBatch *batch = [[FNXPipeBatch alloc] init];
+            batch.inputs = inputs;
+            [_queued addObject:batch];
+            [_ordered addObject:batch];
+            _inFlight += 1;
+        }
+        _exhausted = exhausted;
+        [_condition broadcast];
+        [_condition unlock];
+        if (exhausted) {
+            break;
+        }
+    }
+    _source = nil;
+}
+
+- (void)work
+{
+    for (;;) {
+        [_condition lock];
+        while (0 == _queued.count && !_exhausted && !_cancelled) {
+            [_condition wait];
+        }
+        if (0 == _queued.count || _cancelled) {
+            [_condition unlock];
+            break;
+        }
+        FNXPipeBatch *batch = _queued[0];
+        [_queued removeObjectAtIndex:0];
+        [_condition unlock];
+
+        NSMutableArray *outputs = [NSMutableArray arrayWithCapacity:batch.inputs.count];
+        @autoreleasepool {
+            for (id obj in batch.inputs) {
+                [outputs addObject:_fn(obj) ?: [NSNull fnx_none]];
+            }
+        }
+
+        [_condition lock];
+        batch.outputs = outputs;
+        batch.inputs = nil;
+        [_condition broadcast];
+        [_condition unlock];
+    }
+}
+
+@end
+
+
+@implementation FNXPipeEnumerator
+{
+    FNXPipeState *_state;
+    NSUInteger _workers;
+    BOOL _started;
+    // The results of the batch being handed out.
+    NSArray *_current;
+    NSUInteger _position;
+}
+
++ (instancetype)enumeratorWithSource:(NSEnumerator *)source
+                                  fn:(id (^)(id obj))fn
+                             workers:(NSUInteger)workers
+                          bufferSize:(NSUInteger)bufferSize
+{
+    NSParameterAssert(nil != fn);
+    if (0 == workers || 0 == bufferSize) {
+        @throw [[NSException alloc] initWithName:NSInvalidArgumentException
+                                          reason:NSLocalizedString(@"Worker count and buffer size must be positive", @"Message when [FNXPipeEnumerator enumeratorWithSource:fn:workers:bufferSize:] is called with a count or size of 0")
+                                        userInfo:nil];
+    }
+    FNXPipeEnumerator *result = [[FNXPipeEnumerator alloc] initWithSource:source];
+    FNXPipeState *state = [[FNXPipeState alloc] init];
+    state->_condition = [[NSCondition alloc] init];
+    state->_source = source;
+    state->_fn = [fn copy];
+    // Aim for two batches per worker, so a worker can start on its next batch while the consumer pulls the last one.
+    state->_batchSize = MAX(bufferSize / (2 * workers), (NSUInteger)1);
+    state->_maxBatches = MAX(bufferSize / state->_batchSize, (NSUInteger)1);
+    state->_queued = [NSMutableArray array];
+    state->_ordered = [NSMutableArray array];
+    result->_state = state;
+    result->_workers = workers;
+    return result;
+}
+
+- (void)dealloc
+{
+    [_state->_condition lock];
+    _state->_cancelled = YES;
+    [_state->_condition broadcast];
+    [_state->_condition unlock];
+}
+
+- (void)start
+{
+    _started = YES;
+    FNXPipeState *state = _state;
+    dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+    dispatch_async(queue, ^{
+        [state produce];
+    });
+    for (NSUInteger i = 0; i < _workers; ++i) {
+        dispatch_async(queue, ^{
+            [state work];
+        });
+    }
+}
+
+- (id)nextObject
+{
+    if (_position < _current.count) {
+        return _current[_position++];
+    }
+    if (!_started) {
+        [self start];
+    }
+
+    NSCondition *condition = _state->_condition;
+    [condition lock];
+    if (nil != _current) {
+        // The batch has been handed out, so the producer may fill its place.
+        _current = nil;
+        _state->_inFlight -= 1;
+        [condition broadcast];
+    }
+    NSMutableArray *ordered = _state->_ordered;
+    while (0 == ordered.count ? !_state->_exhausted : nil == [ordered[0] outputs]) {
+        [condition wait];
+    }
+    if (0 == ordered.count) {
+        [condition unlock];
+        return nil;
+    }
+    _current = [ordered[0] outputs];
+    [ordered removeObjectAtIndex:0];
+    [condition unlock];
+
+    _position = 0;
+    return _current[_position++];
+}
+
+@end
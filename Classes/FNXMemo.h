@@ -0,0 +1,62 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Foundation/Foundation.h>
+
+
+// Caches the results of an expensive, pure block by its input object, so repeated inputs are computed once.
+// Inputs are compared with isEqual: and hash, and are retained rather than copied. The block must not return nil; it
+// should return [FNXNone none] instead.
+// A memo holds at most capacity results; beyond that the least recently used result is evicted. A capacity of 0
+// means the memo is unbounded.
+@interface FNXMemo : NSObject
+
+// The maximum number of results held, or 0 if the memo is unbounded.
+@property (nonatomic, assign, readonly) NSUInteger capacity;
+
+// Whether the memo may be used from several threads at once.
+@property (nonatomic, assign, readonly, getter=isConcurrent) BOOL concurrent;
+
+// A block that returns the memoized result for its input, to pass to fnx_map: and the like. It retains the memo.
+@property (nonatomic, copy, readonly) id (^block)(id obj);
+
+// The number of lookups that found a cached result.
+@property (nonatomic, assign, readonly) NSUInteger hits;
+
+// The number of lookups that had to invoke the block.
+@property (nonatomic, assign, readonly) NSUInteger misses;
+
+// The number of results currently held.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+// Returns a memo for use from one thread at a time.
++ (instancetype)memoWithBlock:(id (^)(id obj))block capacity:(NSUInteger)capacity;
+
+// Returns a memo that may be used from several threads at once, for instance with fnx_mapParallel:. Its results are
+// split across independently locked shards by the hash of their input, and each shard evicts its own least recently
+// used result. Two threads that miss on the same input at the same time may both invoke the block.
++ (instancetype)concurrentMemoWithBlock:(id (^)(id obj))block capacity:(NSUInteger)capacity;
+
+// Returns the result of the block for obj, invoking the block only if it isn't cached.
+- (id)valueForObject:(id)obj;
+
+// Evicts all cached results. The hit and miss counters are kept.
+- (void)removeAllValues;
+
+@end
+
+
+// Returns a concurrent memo of fn holding up to 1024 results.
+FOUNDATION_EXPORT FNXMemo *FNXMemoize(id (^fn)(id obj));
@@ -0,0 +1,315 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import "FNXMemo.h"
+#include <pthread.h>
+
+
+// The capacity of the memos made by FNXMemoize.
+static const NSUInteger FNXMemoDefaultCapacity = 1024;
+
+FNXMemo *FNXMemoize(id (^fn)(id obj))
+{
+    return [FNXMemo concurrentMemoWithBlock:fn capacity:FNXMemoDefaultCapacity];
+}
+
+
+// A cached result, linked into its shard's recency list.
+@interface FNXMemoEntry : NSObject
+{
+@package
+    id _key;
+    id _value;
+    FNXMemoEntry *_next;
+    __unsafe_unretained FNXMemoEntry *_previous;
+}
+@end
+
+@implementation FNXMemoEntry
+@end
+
+
+// A portion of a memo's results with its own lock, recency list and counters.
+// The recency list runs from the most recently used entry, _head, to the least recently used one, _tail.
+@interface FNXMemoShard : NSObject
+{
+@package
+    NSMapTable *_entries;
+    FNXMemoEntry *_head;
+    __unsafe_unretained FNXMemoEntry *_tail;
+    NSUInteger _capacity;
+    NSUInteger _hits;
+    NSUInteger _misses;
+    BOOL _locking;
+    pthread_mutex_t _mutex;
+}
+@end
+
+@implementation FNXMemoShard
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity locking:(BOOL)locking
+{
+    self = [super init];
+    if (self) {
+        _entries = [NSMapTable strongToStrongObjectsMapTable];
+        _capacity = capacity;
+        _locking = locking;
+        pthread_mutex_init(&_mutex, NULL);
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [self removeAllEntries];
+    pthread_mutex_destroy(&_mutex);
+}
+
+- (void)lock
+{
+    if (_locking) {
+        pthread_mutex_lock(&_mutex);
+    }
+}
+
+- (void)unlock
+{
+    if (_locking) {
+        pthread_mutex_unlock(&_mutex);
+    }
+}
+
+- (void)unlinkEntry:(FNXMemoEntry *)entry
+{
+    if (nil != entry->_previous) {
+        entry->_previous->_next = entry->_next;
+    } else {
+        _head = entry->_next;
+    }
+    if (nil != entry->_next) {
+        entry->_next->_previous = entry->_previous;
+    } else {
+        _tail = entry->_previous;
+    }
+    entry->_next = nil;
+    entry->_previous = nil;
+}
+
+- (void)pushEntry:(FNXMemoEntry *)entry
+{
+    entry->_next = _head;
+    if (nil != _head) {
+        _head->_previous = entry;
+    } else {
+        _tail = entry;
+    }
+    _head = entry;
+}
+
+// Returns the cached value for key and marks it as the most recently used one, or nil if it isn't cached.
+// Must be called with the lock held.
+- (id)valueForKey:(id)key
+{
+    FNXMemoEntry *entry = [_entries objectForKey:key];
+    if (nil == entry) {
+        _misses += 1;
+        return nil;
+    }
+    _hits += 1;
+    if (entry != _head) {
+        [self unlinkEntry:entry];
+        [self pushEntry:entry];
+    }
+    return entry->_value;
+}
+
+// Caches value for key, evicting the least recently used entry if the shard is full. Returns the cached value, which
+// is the one already there if another thread cached key first. Must be called with the lock held.
+- (id)setValue:(id)value forKey:(id)key
+{
+    FNXMemoEntry *existing = [_entries objectForKey:key];
+    if (nil != existing) {
+        return existing->_value;
+    }
+    if (0 != _capacity && _entries.count >= _capacity) {
+        FNXMemoEntry *evicted = _tail;
+        [self unlinkEntry:evicted];
+        [_entries removeObjectForKey:evicted->_key];
+    }
+    FNXMemoEntry *entry = [[FNXMemoEntry alloc] init];
+    entry->_key = key;
+    entry->_value = value;
+    [self pushEntry:entry];
+    [_entries setObject:entry forKey:key];
+    return value;
+}
+
+- (void)removeAllEntries
+{
+    // Unlink the entries one by one, so that a long list isn't released recursively.
+    while (nil != _head) {
+        FNXMemoEntry *entry = _head;
+        _head = entry->_next;
+        entry->_next = nil;
+    }
+    _tail = nil;
+    [_entries removeAllObjects];
+}
+
+@end
+
+
+@implementation FNXMemo
+{
+    id (^_fn)(id obj);
+    NSArray *_shards;
+    // The shard count is a power of two, so this selects a shard from a hash.
+    NSUInteger _shardMask;
+}
+
++ (instancetype)memoWithBlock:(id (^)(id obj))block capacity:(NSUInteger)capacity
+{
+    return [[FNXMemo alloc] initWithBlock:block capacity:capacity shardCount:1 concurrent:NO];
+}
+
++ (instancetype)concurrentMemoWithBlock:(id (^)(id obj))block capacity:(NSUInteger)capacity
+{
+    // A couple of shards per processor keeps threads from queueing on the same lock most of the time.
+    NSUInteger shardCount = 1;
+    while (shardCount < 2 * [NSProcessInfo processInfo].activeProcessorCount) {
+        shardCount *= 2;
+    }
+    if (0 != capacity) {
+        shardCount = MIN(shardCount, MAX(capacity, (NSUInteger)1));
+    }
+    return [[FNXMemo alloc] initWithBlock:block capacity:capacity shardCount:shardCount concurrent:YES];
+}
+
+- (instancetype)initWithBlock:(id (^)(id obj))block
+                     capacity:(NSUInteger)capacity
+                   shardCount:(NSUInteger)shardCount
+                   concurrent:(BOOL)concurrent
+{
+    NSParameterAssert(nil != block);
+
+    self = [super init];
+    if (self) {
+        _fn = [block copy];
+        _capacity = capacity;
+        _concurrent = concurrent;
+        // Round the shard count down to a power of two so that the mask selects every shard.
+        while (0 != (shardCount & (shardCount - 1))) {
+            shardCount &= shardCount - 1;
+        }
+        // Rounding the share of each shard down keeps the total within the capacity.
+        NSUInteger shardCapacity = (0 != capacity) ? MAX(capacity / shardCount, (NSUInteger)1) : 0;
+        NSMutableArray *shards = [NSMutableArray arrayWithCapacity:shardCount];
+        for (NSUInteger i = 0; i < shardCount; ++i) {
+            [shards addObject:[[FNXMemoShard alloc] initWithCapacity:shardCapacity locking:concurrent]];
+        }
+        _shards = [shards copy];
+        _shardMask = shardCount - 1;
+    }
+    return self;
+}
+
+- (FNXMemoShard *)shardForObject:(id)obj
+{
+    if (0 == _shardMask) {
+        return _shards[0];
+    }
+    // Mix the high bits of the hash in, since many hashes vary mostly in their high or their low bits.
+    NSUInteger hash = [obj hash];
+    hash ^= hash >> 16;
+    return _shards[hash & _shardMask];
+}
+
+- (id (^)(id obj))block
+{
+    FNXMemo *memo = self;
+    return ^id(id obj) {
+        return [memo valueForObject:obj];
+    };
+}
+
+- (id)valueForObject:(id)obj
+{
+    NSParameterAssert(nil != obj);
+    FNXMemoShard *shard = [self shardForObject:obj];
+    [shard lock];
+    id result = [shard valueForKey:obj];
+    [shard unlock];
+    if (nil != result) {
+        return result;
+    }
+    // The block runs outside the lock, so an expensive computation doesn't hold up the other threads of the shard.
+    result = _fn(obj);
+    NSAssert(nil != result, @"A memoized block must return [FNXNone none] rather than nil");
+    [shard lock];
+    result = [shard setValue:result forKey:obj];
+    [shard unlock];
+    return result;
+}
+
+- (void)removeAllValues
+{
+    for (FNXMemoShard *shard in _shards) {
+        [shard lock];
+        [shard removeAllEntries];
+        [shard unlock];
+    }
+}
+
+- (NSUInteger)sumOfShardCounter:(NSUInteger (^)(FNXMemoShard *shard))counter
+{
+    NSUInteger result = 0;
+    for (FNXMemoShard *shard in _shards) {
+        [shard lock];
+        result += counter(shard);
+        [shard unlock];
+    }
+    return result;
+}
+
+- (NSUInteger)hits
+{
+    return [self sumOfShardCounter:^NSUInteger(FNXMemoShard *shard) {
+        return shard->_hits;
+    }];
+}
+
+- (NSUInteger)misses
+{
+    return [self sumOfShardCounter:^NSUInteger(FNXMemoShard *shard) {
+        return shard->_misses;
+    }];
+}
+
+- (NSUInteger)count
+{
+    return [self sumOfShardCounter:^NSUInteger(FNXMemoShard *shard) {
+        return shard->_entries.count;
+    }];
+}
+
+#pragma mark - NSObject
+
+- (NSString *)debugDescription
+{
+    return [NSString stringWithFormat:@"{ FNXMemo.capacity: %lu, count: %lu, hits: %lu, misses: %lu }",
+            (unsigned long)_capacity, (unsigned long)self.count, (unsigned long)self.hits, (unsigned long)self.misses];
+}
+
+@end
@@ -101,7 +101,7 @@
 // Selects all elements except first n ones.
 - (id<FNXTraversable>)fnx_drop:(NSUInteger)n
 {
-    return [NSArray array];
+    return self;
 }
 
 // Selects all elements of this collection which do not satisfy a predicate.
@@ -160,6 +160,14 @@
                                     userInfo:nil];
 }
 
+#pragma mark - FNXIterable
+
+// Returns an iterator for elements in this collection
+- (NSEnumerator *)fnx_iterator
+{
+    return [NSArray array].objectEnumerator;
+}
+
 #pragma mark - FNXOption
 
 // Returns the option's value.
@@ -184,6 +192,14 @@
     return NO;
 }
 
+// Calls some with the option's value if the option is nonempty, otherwise calls none.
+- (void)fnx_ifSome:(void (^)(id value))some else:(void (^)(void))none
+{
+    if (none) {
+        none();
+    }
+}
+
 // Returns this FNXOption if it is nonempty, otherwise return the result of evaluating alternative.
 - (id<FNXOption>)fnx_orElse:(id<FNXOption>(^)(void))alternative
 {
@@ -196,9 +212,10 @@
     return self;
 }
 
+// Returns this option, which is already iterable.
 - (id<FNXIterable>)fnx_toIterable
 {
-    return [FNXOptionAsIterable optionAsIterableWithOption:self];
+    return self;
 }
 
 // Returns the result of applying fn to this Option's value if this Option is nonempty.
@@ -18,7 +18,9 @@
 #import "FNXTraversable.h"
 
 
-@protocol FNXOption <FNXTraversableOnce>
+// Options are iterable collections of zero or one element, so they can be passed wherever an FNXIterable is expected
+// without being wrapped.
+@protocol FNXOption <FNXIterable>
 
 // Returns the option's value.
 // Abstract
@@ -31,9 +33,13 @@
 // Abstract
 - (BOOL)fnx_isDefined;
 
+// Calls some with the option's value if the option is nonempty, otherwise calls none. Either block may be nil.
+- (void)fnx_ifSome:(void (^)(id value))some else:(void (^)(void))none;
+
 // Returns this FNXOption if it is nonempty, otherwise return the result of evaluating alternative.
 - (id<FNXOption>)fnx_orElse:(id<FNXOption>(^)(void))alternative;
 
+// Returns this option, which is already iterable.
 - (id<FNXIterable>)fnx_toIterable;
 
 #pragma mark - FNXTraversableOnce
@@ -79,6 +85,8 @@
 @end
 
 
+// Wraps an option as an FNXIterable.
+// Deprecated: options conform to FNXIterable themselves, so use the option directly.
 @interface FNXOptionAsIterable : NSObject <FNXIterable>
 
 @property (nonatomic, strong, readonly) id<FNXOption> option;
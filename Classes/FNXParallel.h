@@ -0,0 +1,50 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import <Foundation/Foundation.h>
+
+
+// Splits index ranges into contiguous chunks and processes the chunks concurrently.
+// Handing each task a contiguous chunk rather than a single element keeps the dispatch overhead small for cheap
+// blocks and lets each task write its results into its own region of a shared buffer.
+@interface FNXParallel : NSObject
+
+// The number of elements processed by each task when no grain size is requested.
+// 0, the default, derives the grain size from the element count and the number of active processors.
++ (NSUInteger)defaultGrainSize;
+
+// Sets the number of elements processed by each task when no grain size is requested.
++ (void)setDefaultGrainSize:(NSUInteger)grainSize;
+
+// Returns the grain size to use for count elements. A grainSize of 0 uses the default grain size.
++ (NSUInteger)grainSizeForCount:(NSUInteger)count requestedGrainSize:(NSUInteger)grainSize;
+
+// Returns the number of chunks that count elements are split into for the given grain size.
+// When sizing per-chunk buffers, resolve the grain size once with grainSizeForCount:requestedGrainSize: and pass that
+// to both this and forChunksOfCount:grainSize:block:. A positive grain size is used as is, whereas 0 reads the default
+// grain size and processor count again, which may have changed in between.
++ (NSUInteger)chunkCountForCount:(NSUInteger)count grainSize:(NSUInteger)grainSize;
+
+// Splits [0, count) into contiguous chunks and invokes block concurrently for each of them, passing the chunk's index
+// and range. Returns once every chunk has been processed.
+// stop is shared by all chunks: setting *stop to YES skips the chunks that haven't started yet, and long-running chunks
+// may poll it to finish early.
+// Each chunk runs in its own autorelease pool, so block must keep whatever it produces in strong references.
++ (void)forChunksOfCount:(NSUInteger)count
+               grainSize:(NSUInteger)grainSize
+                   block:(void (^)(NSUInteger chunk, NSRange range, BOOL *stop))block;
+
+@end
@@ -0,0 +1,86 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import "FNXParallel.h"
+
+
+// The number of chunks given to each processor when the grain size is derived automatically. Having a few chunks per
+// processor balances the load when some chunks take longer than others.
+static const NSUInteger FNXParallelChunksPerProcessor = 4;
+
+static NSUInteger FNXParallelDefaultGrainSize = 0;
+
+
+@implementation FNXParallel
+
++ (NSUInteger)defaultGrainSize
+{
+    return FNXParallelDefaultGrainSize;
+}
+
++ (void)setDefaultGrainSize:(NSUInteger)grainSize
+{
+    FNXParallelDefaultGrainSize = grainSize;
+}
+
++ (NSUInteger)grainSizeForCount:(NSUInteger)count requestedGrainSize:(NSUInteger)grainSize
+{
+    NSUInteger result = (0 != grainSize) ? grainSize : FNXParallelDefaultGrainSize;
+    if (0 == result) {
+        NSUInteger chunks = [NSProcessInfo processInfo].activeProcessorCount * FNXParallelChunksPerProcessor;
+        result = (count + chunks - 1) / chunks;
+    }
+    return MAX(result, (NSUInteger)1);
+}
+
++ (NSUInteger)chunkCountForCount:(NSUInteger)count grainSize:(NSUInteger)grainSize
+{
+    NSUInteger grain = [self grainSizeForCount:count requestedGrainSize:grainSize];
+    return (count + grain - 1) / grain;
+}
+
++ (void)forChunksOfCount:(NSUInteger)count
+               grainSize:(NSUInteger)grainSize
+                   block:(void (^)(NSUInteger chunk, NSRange range, BOOL *stop))block
+{
+    NSParameterAssert(nil != block);
+    NSUInteger grain = [self grainSizeForCount:count requestedGrainSize:grainSize];
+    NSUInteger chunkCount = (count + grain - 1) / grain;
+    __block volatile BOOL stop = NO;
+
+    void (^processChunk)(size_t) = ^(size_t chunk) {
+        if (stop) {
+            return;
+        }
+        NSUInteger location = chunk * grain;
+        NSRange range = NSMakeRange(location, MIN(grain, count - location));
+        // Drain what the chunk autoreleases as soon as it's done, rather than whenever the worker thread's pool does.
+        @autoreleasepool {
+            block(chunk, range, (BOOL *)&stop);
+        }
+    };
+
+    if (chunkCount <= 1) {
+        // Not worth a trip through GCD.
+        if (1 == chunkCount) {
+            processChunk(0);
+        }
+    } else {
+        dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), processChunk);
+    }
+}
+
+@end
@@ -128,7 +128,9 @@
 // Builds a new collection by applying a function to all elements of this collection.
 - (id<FNXOption>)fnx_map:(id (^)(id obj))fn
 {
-    return [FNXSome someWithValue:fn(_value)];
+    id value = fn(_value);
+    // Reuse this box when fn returns the value unchanged.
+    return (value == _value) ? self : [FNXSome someWithValue:value];
 }
 
 // The size of this collection.
@@ -149,9 +151,9 @@
 - (id<FNXTraversable>)fnx_drop:(NSUInteger)n
 {
     if (0 >= n) {
-        return @[_value];
+        return self;
     } else {
-        return [NSArray array];
+        return [NSNull fnx_none];
     }
 }
 
@@ -192,7 +194,7 @@
 // Selects all elements except the last.
 - (id<FNXTraversable>)fnx_init
 {
-    return [NSArray array];
+    return [NSNull fnx_none];
 }
 
 // Tests whether the collection is not empty.
@@ -204,7 +206,15 @@
 // Selects all elements except the first.
 - (id<FNXTraversable>)fnx_tail
 {
-    return [NSArray array];
+    return [NSNull fnx_none];
+}
+
+#pragma mark - FNXIterable
+
+// Returns an iterator for elements in this collection
+- (NSEnumerator *)fnx_iterator
+{
+    return @[_value].objectEnumerator;
 }
 
 #pragma mark - FNXOption
@@ -229,15 +239,24 @@
     return YES;
 }
 
+// Calls some with the option's value if the option is nonempty, otherwise calls none.
+- (void)fnx_ifSome:(void (^)(id value))some else:(void (^)(void))none
+{
+    if (some) {
+        some(_value);
+    }
+}
+
 // Returns this FNXOption if it is nonempty, otherwise return the result of evaluating alternative.
 - (id<FNXOption>)fnx_orElse:(id<FNXOption>(^)(void))alternative
 {
     return self;
 }
 
+// Returns this option, which is already iterable.
 - (id<FNXIterable>)fnx_toIterable
 {
-    return [FNXOptionAsIterable optionAsIterableWithOption:self];
+    return self;
 }
 
 // Returns the result of applying fn to this Option's value if this Option is nonempty.
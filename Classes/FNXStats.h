@@ -0,0 +1,62 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Foundation/Foundation.h>
+
+// Set FNX_INSTRUMENTATION to 1 (for instance in GCC_PREPROCESSOR_DEFINITIONS) to compile instrumentation into the
+// operators. When it's 0, the default, the instrumentation hooks compile to nothing and FNXStats reports no operators.
+#ifndef FNX_INSTRUMENTATION
+#define FNX_INSTRUMENTATION 0
+#endif
+
+
+// Returns how many allocations the process has made so far.
+typedef uint64_t (*FNXStatsAllocationCounter)(void);
+
+// Per-operator statistics of the instrumented fnx_ operators.
+// When instrumentation is compiled in, it's still off until enabled at runtime; while it's off, each instrumented call
+// only pays for checking a flag. Each call records its element count and wall time, and its allocations when an
+// allocation counter is set. Time and allocations in nested operators are included in those of the outer one. A call that forwards to another
+// instrumented operator, such as fnx_map: to fnx_map:autoreleaseEvery: while a default batch size is set, is recorded
+// under the operator it forwarded to.
+@interface FNXStats : NSObject
+
+// Whether instrumentation was compiled in.
++ (BOOL)isAvailable;
+
+// Whether calls are being recorded. Always NO when instrumentation wasn't compiled in.
++ (BOOL)isEnabled;
+
+// Starts or stops recording calls. Has no effect when instrumentation wasn't compiled in.
++ (void)setEnabled:(BOOL)enabled;
+
+// Sets the function that counts the allocations of the process, such as one that interposes malloc; Foundation has no
+// such count of its own. While one is set, each call also records how many allocations were made while it ran, which
+// includes those of any other thread running at the same time. Pass NULL to stop counting. Has no effect when
+// instrumentation wasn't compiled in.
++ (void)setAllocationCounter:(FNXStatsAllocationCounter)counter;
+
+// Returns the statistics recorded so far, as a dictionary from collection class name to operator selector name to a
+// dictionary of NSNumbers for "calls", "elements" and "nanoseconds", and for "allocations" once a call was recorded
+// with an allocation counter set.
++ (NSDictionary *)snapshot;
+
+// Discards the statistics recorded so far.
++ (void)reset;
+
+// Writes the snapshot to path as JSON.
++ (BOOL)writeSnapshotToJSONFile:(NSString *)path error:(NSError **)error;
+
+@end
@@ -0,0 +1,192 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import "FNXStats.h"
+#import "FNXInstrumentation.h"
+#if FNX_INSTRUMENTATION
+#include <pthread.h>
+#ifdef __APPLE__
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+#endif
+
+
+#if FNX_INSTRUMENTATION
+
+volatile BOOL FNXStatsRecording = NO;
+
+// The counter set through [FNXStats setAllocationCounter:], or NULL.
+static FNXStatsAllocationCounter volatile FNXStatsAllocations = NULL;
+
+// The totals of one operator of one collection class.
+@interface FNXStatsCounter : NSObject
+{
+@package
+    NSUInteger _calls;
+    NSUInteger _elements;
+    uint64_t _nanoseconds;
+    uint64_t _allocations;
+    // The calls recorded with an allocation counter set.
+    NSUInteger _countedCalls;
+}
+@end
+
+@implementation FNXStatsCounter
+@end
+
+// Collection class name to selector name to FNXStatsCounter, guarded by FNXStatsMutex.
+static NSMutableDictionary *FNXStatsCounters = nil;
+static pthread_mutex_t FNXStatsMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t FNXStatsNanoseconds(void)
+{
+#ifdef __APPLE__
+    static mach_timebase_info_data_t timebase;
+    if (0 == timebase.denom) {
+        mach_timebase_info(&timebase);
+    }
+    return mach_absolute_time() * timebase.numer / timebase.denom;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+FNXStatsScope FNXStatsScopeBegin(SEL selector, Class collectionClass, NSUInteger elements)
+{
+    FNXStatsScope scope = { selector, collectionClass, elements, NULL, 0, 0, NO };
+    if (FNXStatsRecording) {
+        scope.active = YES;
+        scope.allocationCounter = FNXStatsAllocations;
+        if (NULL != scope.allocationCounter) {
+            scope.allocationsAtStart = scope.allocationCounter();
+        }
+        scope.start = FNXStatsNanoseconds();
+    }
+    return scope;
+}
+
+void FNXStatsScopeEnd(FNXStatsScope *scope)
+{
+    if (!scope->active) {
+        return;
+    }
+    uint64_t elapsed = FNXStatsNanoseconds() - scope->start;
+    // Read the count before the bookkeeping below, which allocates.
+    uint64_t allocations = 0;
+    if (NULL != scope->allocationCounter) {
+        allocations = scope->allocationCounter() - scope->allocationsAtStart;
+    }
+    NSString *className = NSStringFromClass(scope->collectionClass);
+    NSString *selectorName = NSStringFromSelector(scope->selector);
+    pthread_mutex_lock(&FNXStatsMutex);
+    if (nil == FNXStatsCounters) {
+        FNXStatsCounters = [NSMutableDictionary dictionary];
+    }
+    NSMutableDictionary *operators = FNXStatsCounters[className];
+    if (nil == operators) {
+        operators = [NSMutableDictionary dictionary];
+        FNXStatsCounters[className] = operators;
+    }
+    FNXStatsCounter *counter = operators[selectorName];
+    if (nil == counter) {
+        counter = [[FNXStatsCounter alloc] init];
+        operators[selectorName] = counter;
+    }
+    counter->_calls += 1;
+    counter->_elements += scope->elements;
+    counter->_nanoseconds += elapsed;
+    if (NULL != scope->allocationCounter) {
+        counter->_allocations += allocations;
+        counter->_countedCalls += 1;
+    }
+    pthread_mutex_unlock(&FNXStatsMutex);
+}
+
+#endif
+
+
+@implementation FNXStats
+
++ (BOOL)isAvailable
+{
+    return FNX_INSTRUMENTATION;
+}
+
++ (BOOL)isEnabled
+{
+#if FNX_INSTRUMENTATION
+    return FNXStatsRecording;
+#else
+    return NO;
+#endif
+}
+
++ (void)setEnabled:(BOOL)enabled
+{
+#if FNX_INSTRUMENTATION
+    FNXStatsRecording = enabled;
+#endif
+}
+
++ (void)setAllocationCounter:(FNXStatsAllocationCounter)counter
+{
+#if FNX_INSTRUMENTATION
+    FNXStatsAllocations = counter;
+#endif
+}
+
++ (NSDictionary *)snapshot
+{
+    NSMutableDictionary *result = [NSMutableDictionary dictionary];
+#if FNX_INSTRUMENTATION
+    pthread_mutex_lock(&FNXStatsMutex);
+    [FNXStatsCounters enumerateKeysAndObjectsUsingBlock:^(NSString *className, NSDictionary *operators, BOOL *stop) {
+        NSMutableDictionary *entries = [NSMutableDictionary dictionaryWithCapacity:operators.count];
+        [operators enumerateKeysAndObjectsUsingBlock:^(NSString *selectorName, FNXStatsCounter *counter, BOOL *stop) {
+            NSMutableDictionary *entry = [@{ @"calls": @(counter->_calls),
+                                             @"elements": @(counter->_elements),
+                                             @"nanoseconds": @(counter->_nanoseconds) } mutableCopy];
+            if (counter->_countedCalls > 0) {
+                entry[@"allocations"] = @(counter->_allocations);
+            }
+            entries[selectorName] = [entry copy];
+        }];
+        result[className] = [entries copy];
+    }];
+    pthread_mutex_unlock(&FNXStatsMutex);
+#endif
+    return [result copy];
+}
+
++ (void)reset
+{
+#if FNX_INSTRUMENTATION
+    pthread_mutex_lock(&FNXStatsMutex);
+    [FNXStatsCounters removeAllObjects];
+    pthread_mutex_unlock(&FNXStatsMutex);
+#endif
+}
+
++ (BOOL)writeSnapshotToJSONFile:(NSString *)path error:(NSError **)error
+{
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[self snapshot] options:NSJSONWritingPrettyPrinted error:error];
+    return nil != data && [data writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+@end
@@ -34,4 +34,28 @@
     return [[FNXTuple2 alloc] initWith_1:_1 _2:_2];
 }
 
+#pragma mark - NSObject
+
+- (NSUInteger)hash
+{
+    return [__1 hash] * 31 + [__2 hash];
+}
+
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) {
+        return YES;
+    }
+    if (nil == object || ![object isKindOfClass:[FNXTuple2 class]]) {
+        return NO;
+    }
+    FNXTuple2 *tuple2 = object;
+    return (tuple2._1 == __1 || [tuple2._1 isEqual:__1]) && (tuple2._2 == __2 || [tuple2._2 isEqual:__2]);
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"(%@, %@)", __1, __2];
+}
+
 @end
@@ -0,0 +1,438 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+// The implementation shared by the unboxed numeric arrays. It isn't a standalone header: a .m file imports the
+// interface of its array, defines the macros below, then includes this file once.
+//
+//   FNX_UNBOXED_ARRAY         the class being implemented, such as FNXInt64Array
+//   FNX_UNBOXED_VALUE         the element type, such as int64_t
+//   FNX_UNBOXED_ACCUMULATOR   the type sums and products are accumulated in; uint64_t for integers, so they wrap around
+//   FNX_UNBOXED_NUMBER_VALUE  the NSNumber accessor arrayWithNumbers: converts with, such as longLongValue
+
+#if !defined(FNX_UNBOXED_ARRAY) || !defined(FNX_UNBOXED_VALUE) || !defined(FNX_UNBOXED_ACCUMULATOR) || \
+    !defined(FNX_UNBOXED_NUMBER_VALUE)
+#error "Define FNX_UNBOXED_ARRAY, FNX_UNBOXED_VALUE, FNX_UNBOXED_ACCUMULATOR and FNX_UNBOXED_NUMBER_VALUE first"
+#endif
+
+
+@interface FNX_UNBOXED_ARRAY ()
+{
+    // Owns the values; slices share the storage of the array they were taken from.
+    NSData *_storage;
+}
+
+- (instancetype)initWithStorage:(NSData *)storage values:(const FNX_UNBOXED_VALUE *)values count:(NSUInteger)count;
+
+@end
+
+
+// Returns a buffer for count values, to be handed to FNXUnboxedArrayWithBuffer once filled.
+static NSMutableData *FNXUnboxedBufferForCount(NSUInteger count)
+{
+    return [NSMutableData dataWithLength:MAX(count, (NSUInteger)1) * sizeof(FNX_UNBOXED_VALUE)];
+}
+
+// Returns an array of the first count values of buffer, trimming the buffer to fit.
+static FNX_UNBOXED_ARRAY *FNXUnboxedArrayWithBuffer(NSMutableData *buffer, NSUInteger count)
+{
+    if (buffer.length > MAX(count, (NSUInteger)1) * sizeof(FNX_UNBOXED_VALUE)) {
+        buffer.length = MAX(count, (NSUInteger)1) * sizeof(FNX_UNBOXED_VALUE);
+    }
+    return [[FNX_UNBOXED_ARRAY alloc] initWithStorage:buffer values:(const FNX_UNBOXED_VALUE *)buffer.bytes count:count];
+}
+
+@implementation FNX_UNBOXED_ARRAY
+
++ (instancetype)arrayWithValues:(const FNX_UNBOXED_VALUE *)values count:(NSUInteger)count
+{
+    NSMutableData *buffer = FNXUnboxedBufferForCount(count);
+    if (count > 0) {
+        memcpy(buffer.mutableBytes, values, count * sizeof(FNX_UNBOXED_VALUE));
+    }
+    return FNXUnboxedArrayWithBuffer(buffer, count);
+}
+
++ (instancetype)arrayWithNumbers:(NSArray *)numbers
+{
+    NSUInteger count = numbers.count;
+    NSMutableData *buffer = FNXUnboxedBufferForCount(count);
+    FNX_UNBOXED_VALUE *out = (FNX_UNBOXED_VALUE *)buffer.mutableBytes;
+    NSUInteger i = 0;
+    for (NSNumber *number in numbers) {
+        out[i++] = [number FNX_UNBOXED_NUMBER_VALUE];
+    }
+    return FNXUnboxedArrayWithBuffer(buffer, count);
+}
+
+- (instancetype)initWithStorage:(NSData *)storage values:(const FNX_UNBOXED_VALUE *)values count:(NSUInteger)count
+{
+    self = [super init];
+    if (self) {
+        _storage = storage;
+        _values = values;
+        _count = count;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    return self;
+}
+
+- (FNX_UNBOXED_VALUE)valueAtIndex:(NSUInteger)index
+{
+    if (index >= _count) {
+        @throw [[NSException alloc] initWithName:NSRangeException
+                                          reason:NSLocalizedString(@"Index out of bounds", @"Message when [FNXInt64Array valueAtIndex:] or [FNXDoubleArray valueAtIndex:] is called with a bad index")
+                                        userInfo:nil];
+    }
+    return _values[index];
+}
+
+// Returns the values in range, sharing this array's storage.
+- (FNX_UNBOXED_ARRAY *)sliceWithRange:(NSRange)range
+{
+    return [[FNX_UNBOXED_ARRAY alloc] initWithStorage:_storage values:_values + range.location count:range.length];
+}
+
+- (BOOL)isEqual:(id)object
+{
+    if (self == object) {
+        return YES;
+    }
+    if (![object isKindOfClass:[FNX_UNBOXED_ARRAY class]] || [object count] != _count) {
+        return NO;
+    }
+    const FNX_UNBOXED_VALUE *other = ((FNX_UNBOXED_ARRAY *)object).values;
+    for (NSUInteger i = 0; i < _count; ++i) {
+        if (_values[i] != other[i]) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+- (NSUInteger)hash
+{
+    return _count;
+}
+
+- (NSString *)description
+{
+    return self.fnx_toArray.description;
+}
+
+#pragma mark - Kernels
+
+// The kernels keep four independent accumulators so the additions don't form a single dependency chain.
+// Integer sums are accumulated in uint64_t, where overflow wraps around instead of being undefined; floating point sums
+// are reordered, so they may differ in the last bits from a left fold.
+- (FNX_UNBOXED_VALUE)dot:(FNX_UNBOXED_ARRAY *)other
+{
+    if (other.count != _count) {
+        @throw [[NSException alloc] initWithName:NSInvalidArgumentException
+                                          reason:NSLocalizedString(@"Arrays differ in length", @"Message when [FNXInt64Array dot:] or [FNXDoubleArray dot:] is called with an array of another length")
+                                        userInfo:nil];
+    }
+    const FNX_UNBOXED_VALUE *a = _values;
+    const FNX_UNBOXED_VALUE *b = other.values;
+    FNX_UNBOXED_ACCUMULATOR s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    NSUInteger i = 0;
+    for (; i + 4 <= _count; i += 4) {
+        s0 += (FNX_UNBOXED_ACCUMULATOR)a[i] * (FNX_UNBOXED_ACCUMULATOR)b[i];
+        s1 += (FNX_UNBOXED_ACCUMULATOR)a[i + 1] * (FNX_UNBOXED_ACCUMULATOR)b[i + 1];
+        s2 += (FNX_UNBOXED_ACCUMULATOR)a[i + 2] * (FNX_UNBOXED_ACCUMULATOR)b[i + 2];
+        s3 += (FNX_UNBOXED_ACCUMULATOR)a[i + 3] * (FNX_UNBOXED_ACCUMULATOR)b[i + 3];
+    }
+    for (; i < _count; ++i) {
+        s0 += (FNX_UNBOXED_ACCUMULATOR)a[i] * (FNX_UNBOXED_ACCUMULATOR)b[i];
+    }
+    return (FNX_UNBOXED_VALUE)((s0 + s1) + (s2 + s3));
+}
+
+- (FNX_UNBOXED_VALUE)max
+{
+    if (0 == _count) {
+        @throw [[NSException alloc] initWithName:@"FNXUnsupportedOperation"
+                                          reason:NSLocalizedString(@"empty.max", @"Message when [FNXInt64Array max] or [FNXDoubleArray max] is called")
+                                        userInfo:nil];
+    }
+    FNX_UNBOXED_VALUE result = _values[0];
+    for (NSUInteger i = 1; i < _count; ++i) {
+        result = _values[i] > result ? _values[i] : result;
+    }
+    return result;
+}
+
+- (FNX_UNBOXED_VALUE)min
+{
+    if (0 == _count) {
+        @throw [[NSException alloc] initWithName:@"FNXUnsupportedOperation"
+                                          reason:NSLocalizedString(@"empty.min", @"Message when [FNXInt64Array min] or [FNXDoubleArray min] is called")
+                                        userInfo:nil];
+    }
+    FNX_UNBOXED_VALUE result = _values[0];
+    for (NSUInteger i = 1; i < _count; ++i) {
+        result = _values[i] < result ? _values[i] : result;
+    }
+    return result;
+}
+
+- (FNX_UNBOXED_ARRAY *)prefixSums
+{
+    NSMutableData *buffer = FNXUnboxedBufferForCount(_count);
+    FNX_UNBOXED_VALUE *out = (FNX_UNBOXED_VALUE *)buffer.mutableBytes;
+    FNX_UNBOXED_ACCUMULATOR sum = 0;
+    for (NSUInteger i = 0; i < _count; ++i) {
+        sum += (FNX_UNBOXED_ACCUMULATOR)_values[i];
+        out[i] = (FNX_UNBOXED_VALUE)sum;
+    }
+    return FNXUnboxedArrayWithBuffer(buffer, _count);
+}
+
+- (FNX_UNBOXED_ARRAY *)scaledBy:(FNX_UNBOXED_VALUE)factor
+{
+    NSMutableData *buffer = FNXUnboxedBufferForCount(_count);
+    FNX_UNBOXED_VALUE *out = (FNX_UNBOXED_VALUE *)buffer.mutableBytes;
+    const FNX_UNBOXED_VALUE *in = _values;
+    for (NSUInteger i = 0; i < _count; ++i) {
+        out[i] = (FNX_UNBOXED_VALUE)((FNX_UNBOXED_ACCUMULATOR)in[i] * (FNX_UNBOXED_ACCUMULATOR)factor);
+    }
+    return FNXUnboxedArrayWithBuffer(buffer, _count);
+}
+
+- (FNX_UNBOXED_VALUE)sum
+{
+    const FNX_UNBOXED_VALUE *in = _values;
+    FNX_UNBOXED_ACCUMULATOR s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    NSUInteger i = 0;
+    for (; i + 4 <= _count; i += 4) {
+        s0 += (FNX_UNBOXED_ACCUMULATOR)in[i];
+        s1 += (FNX_UNBOXED_ACCUMULATOR)in[i + 1];
+        s2 += (FNX_UNBOXED_ACCUMULATOR)in[i + 2];
+        s3 += (FNX_UNBOXED_ACCUMULATOR)in[i + 3];
+    }
+    for (; i < _count; ++i) {
+        s0 += (FNX_UNBOXED_ACCUMULATOR)in[i];
+    }
+    return (FNX_UNBOXED_VALUE)((s0 + s1) + (s2 + s3));
+}
+
+- (FNX_UNBOXED_ARRAY *)valuesAbove:(FNX_UNBOXED_VALUE)threshold
+{
+    NSMutableData *buffer = FNXUnboxedBufferForCount(_count);
+    FNX_UNBOXED_VALUE *out = (FNX_UNBOXED_VALUE *)buffer.mutableBytes;
+    NSUInteger n = 0;
+    // Write every value and only advance past the selected ones, so the loop has no branch to mispredict.
+    for (NSUInteger i = 0; i < _count; ++i) {
+        FNX_UNBOXED_VALUE value = _values[i];
+        out[n] = value;
+        n += value > threshold;
+    }
+    return FNXUnboxedArrayWithBuffer(buffer, n);
+}
+
+#pragma mark - Operators
+
+// Counts the number of values which satisfy a predicate.
+- (NSUInteger)fnx_count:(BOOL (^)(FNX_UNBOXED_VALUE value))pred
+{
+    NSParameterAssert(nil != pred);
+    NSUInteger result = 0;
+    for (NSUInteger i = 0; i < _count; ++i) {
+        if (pred(_values[i])) {
+            result += 1;
+        }
+    }
+    return result;
+}
+
+// Selects all values except first n ones.
+- (FNX_UNBOXED_ARRAY *)fnx_drop:(NSUInteger)n
+{
+    NSUInteger dropped = MIN(n, _count);
+    return [self sliceWithRange:NSMakeRange(dropped, _count - dropped)];
+}
+
+// Tests whether a predicate holds for some of the values.
+- (BOOL)fnx_exists:(BOOL (^)(FNX_UNBOXED_VALUE value))pred
+{
+    NSParameterAssert(nil != pred);
+    for (NSUInteger i = 0; i < _count; ++i) {
+        if (pred(_values[i])) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
+// Selects all values which satisfy a predicate.
+- (FNX_UNBOXED_ARRAY *)fnx_filter:(BOOL (^)(FNX_UNBOXED_VALUE value))pred
+{
+    NSParameterAssert(nil != pred);
+    NSMutableData *buffer = FNXUnboxedBufferForCount(_count);
+    FNX_UNBOXED_VALUE *out = (FNX_UNBOXED_VALUE *)buffer.mutableBytes;
+    NSUInteger n = 0;
+    for (NSUInteger i = 0; i < _count; ++i) {
+        if (pred(_values[i])) {
+            out[n++] = _values[i];
+        }
+    }
+    return FNXUnboxedArrayWithBuffer(buffer, n);
+}
+
+// Selects all values which do not satisfy a predicate.
+- (FNX_UNBOXED_ARRAY *)fnx_filterNot:(BOOL (^)(FNX_UNBOXED_VALUE value))pred
+{
+    NSParameterAssert(nil != pred);
+    return [self fnx_filter:^BOOL(FNX_UNBOXED_VALUE value) {
+        return !pred(value);
+    }];
+}
+
+// Applies a binary operator to a start value and all values, going left to right.
+- (FNX_UNBOXED_VALUE)fnx_foldLeftWithStartValue:(FNX_UNBOXED_VALUE)startValue op:(FNX_UNBOXED_VALUE (^)(FNX_UNBOXED_VALUE accumulator, FNX_UNBOXED_VALUE value))op
+{
+    NSParameterAssert(nil != op);
+    FNX_UNBOXED_VALUE accumulator = startValue;
+    for (NSUInteger i = 0; i < _count; ++i) {
+        accumulator = op(accumulator, _values[i]);
+    }
+    return accumulator;
+}
+
+// Applies a binary operator to all values and a start value, going right to left.
+- (FNX_UNBOXED_VALUE)fnx_foldRightWithStartValue:(FNX_UNBOXED_VALUE)startValue op:(FNX_UNBOXED_VALUE (^)(FNX_UNBOXED_VALUE value, FNX_UNBOXED_VALUE accumulator))op
+{
+    NSParameterAssert(nil != op);
+    FNX_UNBOXED_VALUE accumulator = startValue;
+    for (NSUInteger i = _count; i > 0; --i) {
+        accumulator = op(_values[i - 1], accumulator);
+    }
+    return accumulator;
+}
+
+// Tests whether a predicate holds for all values.
+- (BOOL)fnx_forall:(BOOL (^)(FNX_UNBOXED_VALUE value))pred
+{
+    NSParameterAssert(nil != pred);
+    for (NSUInteger i = 0; i < _count; ++i) {
+        if (!pred(_values[i])) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+// Applies a function fn to all values.
+- (void)fnx_foreach:(void (^)(FNX_UNBOXED_VALUE value))fn
+{
+    NSParameterAssert(nil != fn);
+    for (NSUInteger i = 0; i < _count; ++i) {
+        fn(_values[i]);
+    }
+}
+
+// Selects the first value.
+- (FNX_UNBOXED_VALUE)fnx_head
+{
+    if (0 == _count) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Head of empty array", @"Message when [FNXInt64Array head] or [FNXDoubleArray head] is called")
+                                        userInfo:nil];
+    }
+    return _values[0];
+}
+
+// Selects all values except the last.
+- (FNX_UNBOXED_ARRAY *)fnx_init
+{
+    if (0 == _count) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Init of empty array", @"Message when [FNXInt64Array init] or [FNXDoubleArray init] is called")
+                                        userInfo:nil];
+    }
+    return [self sliceWithRange:NSMakeRange(0, _count - 1)];
+}
+
+// Tests whether this array is empty.
+- (BOOL)fnx_isEmpty
+{
+    return 0 == _count;
+}
+
+// Selects the last value.
+- (FNX_UNBOXED_VALUE)fnx_last
+{
+    if (0 == _count) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Last of empty array", @"Message when [FNXInt64Array last] or [FNXDoubleArray last] is called")
+                                        userInfo:nil];
+    }
+    return _values[_count - 1];
+}
+
+// Builds a new array by applying a function to all values.
+- (FNX_UNBOXED_ARRAY *)fnx_map:(FNX_UNBOXED_VALUE (^)(FNX_UNBOXED_VALUE value))fn
+{
+    NSParameterAssert(nil != fn);
+    NSMutableData *buffer = FNXUnboxedBufferForCount(_count);
+    FNX_UNBOXED_VALUE *out = (FNX_UNBOXED_VALUE *)buffer.mutableBytes;
+    for (NSUInteger i = 0; i < _count; ++i) {
+        out[i] = fn(_values[i]);
+    }
+    return FNXUnboxedArrayWithBuffer(buffer, _count);
+}
+
+// Tests whether this array is not empty.
+- (BOOL)fnx_nonEmpty
+{
+    return _count > 0;
+}
+
+// The number of values.
+- (NSUInteger)fnx_size
+{
+    return _count;
+}
+
+// Selects all values except the first.
+- (FNX_UNBOXED_ARRAY *)fnx_tail
+{
+    if (0 == _count) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Tail of empty array", @"Message when [FNXInt64Array tail] or [FNXDoubleArray tail] is called")
+                                        userInfo:nil];
+    }
+    return [self sliceWithRange:NSMakeRange(1, _count - 1)];
+}
+
+// Converts this array to an array of NSNumber objects.
+- (NSArray *)fnx_toArray
+{
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:_count];
+    for (NSUInteger i = 0; i < _count; ++i) {
+        [result addObject:@(_values[i])];
+    }
+    return [result copy];
+}
+
+@end
+
+#undef FNX_UNBOXED_ARRAY
+#undef FNX_UNBOXED_VALUE
+#undef FNX_UNBOXED_ACCUMULATOR
+#undef FNX_UNBOXED_NUMBER_VALUE
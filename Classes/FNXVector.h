@@ -0,0 +1,105 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Foundation/Foundation.h>
+#import "FNXTraversable.h"
+
+@class FNXView;
+
+
+// A persistent immutable vector, stored as a 32-way trie of leaves of 32 elements plus a tail leaf for the last ones.
+// Adding an element, replacing one, and slicing return a new vector that shares all but O(log32 n) nodes with this one,
+// so they take effectively constant time and memory however many elements there are. Indexing is O(log32 n).
+// A slice shares the nodes of the vector it was taken from, so it keeps all of that vector's elements alive.
+@interface FNXVector : NSObject <FNXIterable, NSFastEnumeration, NSCopying>
+
+// The number of elements.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+// Returns the empty vector.
++ (instancetype)vector;
+
+// Returns a vector of the elements of array.
++ (instancetype)vectorWithArray:(NSArray *)array;
+
+// Returns the element at index. Raises NSRangeException if index is out of bounds.
+- (id)objectAtIndex:(NSUInteger)index;
+- (id)objectAtIndexedSubscript:(NSUInteger)index;
+
+// Returns a vector with obj added at the end.
+- (FNXVector *)vectorByAddingObject:(id)obj;
+
+// Returns a vector with the elements of collection added at the end.
+- (FNXVector *)vectorByAddingObjectsFromCollection:(id<NSFastEnumeration>)collection;
+
+// Returns a vector with the element at index replaced by obj. Raises NSRangeException if index is out of bounds.
+- (FNXVector *)vectorByReplacingObjectAtIndex:(NSUInteger)index withObject:(id)obj;
+
+// Returns the elements in range, sharing this vector's nodes. Raises NSRangeException if range is out of bounds.
+- (FNXVector *)subvectorWithRange:(NSRange)range;
+
+// Selects all elements except first n ones.
+- (FNXVector *)fnx_drop:(NSUInteger)n;
+
+// Selects all elements of this collection which satisfy a predicate.
+- (FNXVector *)fnx_filter:(BOOL (^)(id obj))pred;
+
+// Selects all elements of this collection which do not satisfy a predicate.
+- (FNXVector *)fnx_filterNot:(BOOL (^)(id obj))pred;
+
+// Finds the first element of the collection satisfying a predicate, or nil if there is none.
+- (id)fnx_findValue:(BOOL (^)(id obj))pred;
+
+// Builds a new collection by applying a function to all elements of this collection
+// and using the elements of the resulting collections.
+- (FNXVector *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn;
+
+// Selects all elements except the last.
+- (FNXVector *)fnx_init;
+
+// Builds a new collection by applying a function to all elements of this collection.
+// If fn could return nil, it must return [FNXNone none] instead and the other values
+// should be mapped as FNXSome values.
+- (FNXVector *)fnx_map:(id (^)(id obj))fn;
+
+// Selects all elements except the first.
+- (FNXVector *)fnx_tail;
+
+// Selects the first n elements.
+- (FNXVector *)fnx_take:(NSUInteger)n;
+
+// Returns a lazy view of this collection, whose transformers are fused into a single pass.
+- (FNXView *)fnx_view;
+
+@end
+
+
+// Builds an FNXVector by adding elements in place, rather than copying the path to the new element for each one.
+@interface FNXVectorBuilder : NSObject
+
+// The number of elements added so far.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
++ (instancetype)builder;
+
+- (void)addObject:(id)obj;
+
+- (void)addObjectsFromCollection:(id<NSFastEnumeration>)collection;
+
+// Returns a vector of the elements added so far. The builder may go on adding elements; that doesn't affect the vectors
+// it has already returned.
+- (FNXVector *)vector;
+
+@end
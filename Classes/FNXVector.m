@@ -0,0 +1,708 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import "FNXVector.h"
+#import "FNXOption.h"
+#import "FNXSome.h"
+#import "FNXNone.h"
+#import "FNXView.h"
+
+
+// Each node holds 32 slots, indexed by 5 bits of the element index.
+enum {
+    FNXVectorBits = 5,
+    FNXVectorWidth = 1 << FNXVectorBits,
+    FNXVectorMask = FNXVectorWidth - 1
+};
+
+
+// A node of the trie. The slots of a leaf hold elements, the slots of an inner node hold child nodes.
+@interface FNXVectorNode : NSObject
+{
+@package
+    __strong id _slots[FNXVectorWidth];
+    // The token of the builder that may modify this node in place, or nil if the node may be shared.
+    id _edit;
+}
+@end
+
+@implementation FNXVectorNode
+@end
+
+
+// Iterates a vector a leaf at a time, through its fast enumeration.
+@interface FNXVectorEnumerator : NSEnumerator
+{
+    FNXVector *_vector;
+    NSFastEnumerationState _state;
+    NSUInteger _available;
+    NSUInteger _position;
+}
+
++ (instancetype)enumeratorWithVector:(FNXVector *)vector;
+
+@end
+
+
+@interface FNXVector ()
+{
+    FNXVectorNode *_root;
+    FNXVectorNode *_tail;
+    // The number of elements stored in the trie and the tail. A slice only uses _count of them, from _origin.
+    NSUInteger _size;
+    NSUInteger _shift;
+    NSUInteger _origin;
+    NSUInteger _count;
+}
+
+- (instancetype)initWithRoot:(FNXVectorNode *)root
+                        tail:(FNXVectorNode *)tail
+                        size:(NSUInteger)size
+                       shift:(NSUInteger)shift
+                      origin:(NSUInteger)origin
+                       count:(NSUInteger)count;
+
+@end
+
+
+@interface FNXVectorBuilder ()
+{
+    FNXVectorNode *_root;
+    FNXVectorNode *_tail;
+    NSUInteger _shift;
+    NSUInteger _count;
+    id _edit;
+}
+@end
+
+
+// Returns the index of the first element in the tail of a vector of size elements.
+static inline NSUInteger FNXVectorTailOffset(NSUInteger size)
+{
+    return size < FNXVectorWidth ? 0 : ((size - 1) >> FNXVectorBits) << FNXVectorBits;
+}
+
+static FNXVectorNode *FNXVectorNodeCopy(FNXVectorNode *node, id edit)
+{
+    FNXVectorNode *result = [[FNXVectorNode alloc] init];
+    if (nil != node) {
+        for (NSUInteger i = 0; i < FNXVectorWidth; ++i) {
+            result->_slots[i] = node->_slots[i];
+        }
+    }
+    result->_edit = edit;
+    return result;
+}
+
+// Returns node if the builder owning edit may modify it in place, or a copy it may modify otherwise.
+static FNXVectorNode *FNXVectorEditableNode(FNXVectorNode *node, id edit)
+{
+    if (nil != edit && node->_edit == edit) {
+        return node;
+    }
+    return FNXVectorNodeCopy(node, edit);
+}
+
+// Returns a chain of inner nodes, level bits high, leading down to leaf.
+static FNXVectorNode *FNXVectorNewPath(NSUInteger level, FNXVectorNode *leaf, id edit)
+{
+    if (0 == level) {
+        return leaf;
+    }
+    FNXVectorNode *node = FNXVectorNodeCopy(nil, edit);
+    node->_slots[0] = FNXVectorNewPath(level - FNXVectorBits, leaf, edit);
+    return node;
+}
+
+// Returns parent with leaf added after the last leaf below it, copying the path to the new leaf.
+// size is the number of elements stored before the leaf is added, counting the ones in leaf.
+static FNXVectorNode *FNXVectorPushLeaf(NSUInteger size, NSUInteger level, FNXVectorNode *parent,
+                                        FNXVectorNode *leaf, id edit)
+{
+    FNXVectorNode *result = FNXVectorEditableNode(parent, edit);
+    NSUInteger slot = ((size - 1) >> level) & FNXVectorMask;
+    if (FNXVectorBits == level) {
+        result->_slots[slot] = leaf;
+    } else {
+        FNXVectorNode *child = parent->_slots[slot];
+        result->_slots[slot] = (nil != child)
+            ? FNXVectorPushLeaf(size, level - FNXVectorBits, child, leaf, edit)
+            : FNXVectorNewPath(level - FNXVectorBits, leaf, edit);
+    }
+    return result;
+}
+
+// Returns node with the element at index replaced by obj, copying the path to it.
+static FNXVectorNode *FNXVectorReplace(NSUInteger level, FNXVectorNode *node, NSUInteger index, id obj)
+{
+    FNXVectorNode *result = FNXVectorNodeCopy(node, nil);
+    if (0 == level) {
+        result->_slots[index & FNXVectorMask] = obj;
+    } else {
+        NSUInteger slot = (index >> level) & FNXVectorMask;
+        result->_slots[slot] = FNXVectorReplace(level - FNXVectorBits, node->_slots[slot], index, obj);
+    }
+    return result;
+}
+
+// Adds the full tail leaf to the trie, growing the trie a level if its root is full, and starts a new tail with obj.
+static void FNXVectorPushTail(FNXVectorNode * __strong *root, FNXVectorNode * __strong *tail, NSUInteger *shift,
+                              NSUInteger size, id obj, id edit)
+{
+    if ((size >> FNXVectorBits) > ((NSUInteger)1 << *shift)) {
+        FNXVectorNode *newRoot = FNXVectorNodeCopy(nil, edit);
+        newRoot->_slots[0] = *root;
+        newRoot->_slots[1] = FNXVectorNewPath(*shift, *tail, edit);
+        *root = newRoot;
+        *shift += FNXVectorBits;
+    } else {
+        *root = FNXVectorPushLeaf(size, *shift, *root, *tail, edit);
+    }
+    FNXVectorNode *newTail = FNXVectorNodeCopy(nil, edit);
+    newTail->_slots[0] = obj;
+    *tail = newTail;
+}
+
+@implementation FNXVector
+
++ (instancetype)vector
+{
+    static FNXVector *empty;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        empty = [[FNXVector alloc] initWithRoot:[[FNXVectorNode alloc] init]
+                                           tail:[[FNXVectorNode alloc] init]
+                                           size:0
+                                          shift:FNXVectorBits
+                                         origin:0
+                                          count:0];
+    });
+    return empty;
+}
+
++ (instancetype)vectorWithArray:(NSArray *)array
+{
+    FNXVectorBuilder *builder = [FNXVectorBuilder builder];
+    [builder addObjectsFromCollection:array];
+    return [builder vector];
+}
+
+- (instancetype)initWithRoot:(FNXVectorNode *)root
+                        tail:(FNXVectorNode *)tail
+                        size:(NSUInteger)size
+                       shift:(NSUInteger)shift
+                      origin:(NSUInteger)origin
+                       count:(NSUInteger)count
+{
+    self = [super init];
+    if (self) {
+        _root = root;
+        _tail = tail;
+        _size = size;
+        _shift = shift;
+        _origin = origin;
+        _count = count;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    return self;
+}
+
+// Returns the leaf holding the element at index, counted from the start of the stored elements rather than _origin.
+- (FNXVectorNode *)leafForStoredIndex:(NSUInteger)index
+{
+    if (index >= FNXVectorTailOffset(_size)) {
+        return _tail;
+    }
+    FNXVectorNode *node = _root;
+    for (NSUInteger level = _shift; level > 0; level -= FNXVectorBits) {
+        node = node->_slots[(index >> level) & FNXVectorMask];
+    }
+    return node;
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+    if (index >= _count) {
+        @throw [[NSException alloc] initWithName:NSRangeException
+                                          reason:NSLocalizedString(@"Index out of bounds", @"Message when [FNXVector objectAtIndex:] is called with a bad index")
+                                        userInfo:nil];
+    }
+    NSUInteger stored = _origin + index;
+    return [self leafForStoredIndex:stored]->_slots[stored & FNXVectorMask];
+}
+
+- (id)objectAtIndexedSubscript:(NSUInteger)index
+{
+    return [self objectAtIndex:index];
+}
+
+// Returns the stored elements with the one at index replaced by obj, keeping this vector's origin and count.
+- (FNXVector *)vectorByReplacingStoredObjectAtIndex:(NSUInteger)index withObject:(id)obj count:(NSUInteger)count
+{
+    FNXVectorNode *root = _root;
+    FNXVectorNode *tail = _tail;
+    if (index >= FNXVectorTailOffset(_size)) {
+        tail = FNXVectorNodeCopy(_tail, nil);
+        tail->_slots[index & FNXVectorMask] = obj;
+    } else {
+        root = FNXVectorReplace(_shift, _root, index, obj);
+    }
+    return [[FNXVector alloc] initWithRoot:root tail:tail size:_size shift:_shift origin:_origin count:count];
+}
+
+- (FNXVector *)vectorByAddingObject:(id)obj
+{
+    NSParameterAssert(nil != obj);
+    NSUInteger end = _origin + _count;
+    if (end < _size) {
+        // This is a slice ending before the stored elements do, so the element after it is overwritten.
+        return [self vectorByReplacingStoredObjectAtIndex:end withObject:obj count:_count + 1];
+    }
+    FNXVectorNode *root = _root;
+    FNXVectorNode *tail;
+    NSUInteger shift = _shift;
+    if (_size - FNXVectorTailOffset(_size) < FNXVectorWidth) {
+        tail = FNXVectorNodeCopy(_tail, nil);
+        tail->_slots[_size & FNXVectorMask] = obj;
+    } else {
+        tail = _tail;
+        FNXVectorPushTail(&root, &tail, &shift, _size, obj, nil);
+    }
+    return [[FNXVector alloc] initWithRoot:root tail:tail size:_size + 1 shift:shift origin:_origin count:_count + 1];
+}
+
+- (FNXVector *)vectorByAddingObjectsFromCollection:(id<NSFastEnumeration>)collection
+{
+    FNXVectorBuilder *builder = [FNXVectorBuilder builder];
+    [builder addObjectsFromCollection:self];
+    [builder addObjectsFromCollection:collection];
+    return [builder vector];
+}
+
+- (FNXVector *)vectorByReplacingObjectAtIndex:(NSUInteger)index withObject:(id)obj
+{
+    NSParameterAssert(nil != obj);
+    if (index >= _count) {
+        @throw [[NSException alloc] initWithName:NSRangeException
+                                          reason:NSLocalizedString(@"Index out of bounds", @"Message when [FNXVector vectorByReplacingObjectAtIndex:withObject:] is called with a bad index")
+                                        userInfo:nil];
+    }
+    return [self vectorByReplacingStoredObjectAtIndex:_origin + index withObject:obj count:_count];
+}
+
+- (FNXVector *)subvectorWithRange:(NSRange)range
+{
+    if (range.location > _count || range.length > _count - range.location) {
+        @throw [[NSException alloc] initWithName:NSRangeException
+                                          reason:NSLocalizedString(@"Range out of bounds", @"Message when [FNXVector subvectorWithRange:] is called with a bad range")
+                                        userInfo:nil];
+    }
+    if (range.length == _count) {
+        return self;
+    }
+    return [[FNXVector alloc] initWithRoot:_root
+                                      tail:_tail
+                                      size:_size
+                                     shift:_shift
+                                    origin:_origin + range.location
+                                     count:range.length];
+}
+
+// Returns the elements a leaf at a time, pointing into the leaves rather than copying to buffer.
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(id __unsafe_unretained [])buffer
+                                    count:(NSUInteger)len
+{
+    NSUInteger index = state->state;
+    if (index >= _count) {
+        return 0;
+    }
+    // The vector never changes.
+    state->mutationsPtr = &state->extra[0];
+    NSUInteger stored = _origin + index;
+    FNXVectorNode *leaf = [self leafForStoredIndex:stored];
+    NSUInteger offset = stored & FNXVectorMask;
+    NSUInteger n = MIN(FNXVectorWidth - offset, _count - index);
+    state->itemsPtr = (__unsafe_unretained id *)(void *)&leaf->_slots[offset];
+    state->state = index + n;
+    return n;
+}
+
+- (BOOL)isEqual:(id)object
+{
+    if (self == object) {
+        return YES;
+    }
+    if (![object isKindOfClass:[FNXVector class]] || [object count] != _count) {
+        return NO;
+    }
+    NSEnumerator *other = [object fnx_iterator];
+    for (id obj in self) {
+        if (![obj isEqual:other.nextObject]) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+- (NSUInteger)hash
+{
+    return _count > 0 ? _count ^ [self.fnx_head hash] : 0;
+}
+
+- (NSString *)description
+{
+    return self.fnx_toArray.description;
+}
+
+// Selects all elements except first n ones.
+- (FNXVector *)fnx_drop:(NSUInteger)n
+{
+    NSUInteger dropped = MIN(n, _count);
+    return [self subvectorWithRange:NSMakeRange(dropped, _count - dropped)];
+}
+
+// Selects all elements of this collection which satisfy a predicate.
+- (FNXVector *)fnx_filter:(BOOL (^)(id obj))pred
+{
+    FNXVectorBuilder *builder = [FNXVectorBuilder builder];
+    for (id obj in self) {
+        if (pred(obj)) {
+            [builder addObject:obj];
+        }
+    }
+    return [builder vector];
+}
+
+// Selects all elements of this collection which do not satisfy a predicate.
+- (FNXVector *)fnx_filterNot:(BOOL (^)(id obj))pred
+{
+    return [self fnx_filter:^BOOL(id obj) {
+        return !pred(obj);
+    }];
+}
+
+// Finds the first element of the collection satisfying a predicate, or nil if there is none.
+- (id)fnx_findValue:(BOOL (^)(id obj))pred
+{
+    for (id obj in self) {
+        if (pred(obj)) {
+            return obj;
+        }
+    }
+    return nil;
+}
+
+// Builds a new collection by applying a function to all elements of this collection
+// and using the elements of the resulting collections.
+- (FNXVector *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn
+{
+    FNXVectorBuilder *builder = [FNXVectorBuilder builder];
+    for (id obj in self) {
+        id<FNXTraversableOnce> elements = fn(obj);
+        if ([elements conformsToProtocol:@protocol(NSFastEnumeration)]) {
+            [builder addObjectsFromCollection:(id<NSFastEnumeration>)elements];
+        } else {
+            [elements fnx_foreach:^(id element) {
+                [builder addObject:element];
+            }];
+        }
+    }
+    return [builder vector];
+}
+
+// Selects all elements except the last.
+- (FNXVector *)fnx_init
+{
+    if (0 == _count) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Init of empty vector", @"Message when [FNXVector init] is called")
+                                        userInfo:nil];
+    }
+    return [self subvectorWithRange:NSMakeRange(0, _count - 1)];
+}
+
+// Builds a new collection by applying a function to all elements of this collection.
+- (FNXVector *)fnx_map:(id (^)(id obj))fn
+{
+    FNXVectorBuilder *builder = [FNXVectorBuilder builder];
+    for (id obj in self) {
+        [builder addObject:fn(obj)];
+    }
+    return [builder vector];
+}
+
+// Selects all elements except the first.
+- (FNXVector *)fnx_tail
+{
+    if (0 == _count) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Tail of empty vector", @"Message when [FNXVector tail] is called")
+                                        userInfo:nil];
+    }
+    return [self subvectorWithRange:NSMakeRange(1, _count - 1)];
+}
+
+// Selects the first n elements.
+- (FNXVector *)fnx_take:(NSUInteger)n
+{
+    return [self subvectorWithRange:NSMakeRange(0, MIN(n, _count))];
+}
+
+// Returns a lazy view of this collection, whose transformers are fused into a single pass.
+- (FNXView *)fnx_view
+{
+    return [FNXView viewWithCollection:self];
+}
+
+// Counts the number of elements in the collection which satisfy a predicate.
+- (NSUInteger)fnx_count:(BOOL (^)(id obj))pred
+{
+    NSUInteger result = 0;
+    for (id obj in self) {
+        if (pred(obj)) {
+            result += 1;
+        }
+    }
+    return result;
+}
+
+// Tests whether a predicate holds for some of the elements of this traversable.
+- (BOOL)fnx_exists:(BOOL (^)(id obj))pred
+{
+    for (id obj in self) {
+        if (pred(obj)) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
+// Finds the first element of the collection satisfying a predicate, if any.
+- (id<FNXOption>)fnx_find:(BOOL (^)(id obj))pred
+{
+    id result = [self fnx_findValue:pred];
+    return nil != result ? [FNXSome someWithValue:result] : [NSNull fnx_none];
+}
+
+// Applies a binary operator to a start value and all elements of this collection, going left to right.
+// op(...op(startValue, x_1), x_2, ..., x_n)
+- (id)fnx_foldLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op
+{
+    id accumulator = startValue;
+    for (id obj in self) {
+        accumulator = op(accumulator, obj);
+    }
+    return accumulator;
+}
+
+// Applies a binary operator to all elements of this iterable collection and a start value, going right to left.
+// op(x_1, op(x_2, ... op(x_n, z)...))
+- (id)fnx_foldRightWithStartValue:(id)startValue op:(id (^)(id obj, id accumulator))op
+{
+    id accumulator = startValue;
+    // Walk the leaves backwards, so each one is only looked up once.
+    NSUInteger remaining = _count;
+    while (remaining > 0) {
+        NSUInteger stored = _origin + remaining - 1;
+        FNXVectorNode *leaf = [self leafForStoredIndex:stored];
+        NSUInteger offset = stored & FNXVectorMask;
+        NSUInteger n = MIN(offset + 1, remaining);
+        for (NSUInteger i = 0; i < n; ++i) {
+            accumulator = op(leaf->_slots[offset - i], accumulator);
+        }
+        remaining -= n;
+    }
+    return accumulator;
+}
+
+// Tests whether a predicate holds for all elements of this collection.
+- (BOOL)fnx_forall:(BOOL (^)(id obj))pred
+{
+    for (id obj in self) {
+        if (!pred(obj)) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+// Applies a function fn to all elements of this collection.
+- (void)fnx_foreach:(void (^)(id obj))fn
+{
+    for (id obj in self) {
+        fn(obj);
+    }
+}
+
+// Selects the first element of this collection.
+- (id)fnx_head
+{
+    if (0 == _count) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Head of empty vector", @"Message when [FNXVector head] is called")
+                                        userInfo:nil];
+    }
+    return [self objectAtIndex:0];
+}
+
+// Optionally selects the first element of this collection.
+- (id<FNXOption>)fnx_headOption
+{
+    return _count > 0 ? [FNXSome someWithValue:[self objectAtIndex:0]] : [NSNull fnx_none];
+}
+
+// Tests whether this collection is empty.
+- (BOOL)fnx_isEmpty
+{
+    return 0 == _count;
+}
+
+// Selects the last element.
+- (id)fnx_last
+{
+    if (0 == _count) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Last of empty vector", @"Message when [FNXVector last] is called")
+                                        userInfo:nil];
+    }
+    return [self objectAtIndex:_count - 1];
+}
+
+// Optionally selects the last element.
+- (id<FNXOption>)fnx_lastOption
+{
+    return _count > 0 ? [FNXSome someWithValue:[self objectAtIndex:_count - 1]] : [NSNull fnx_none];
+}
+
+// Tests whether this collection is not empty.
+- (BOOL)fnx_nonEmpty
+{
+    return _count > 0;
+}
+
+// The size of this collection.
+- (NSUInteger)fnx_size
+{
+    return _count;
+}
+
+// Converts this traversable to an array.
+- (NSArray *)fnx_toArray
+{
+    if (0 == _count) {
+        return [NSArray array];
+    }
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(sizeof(id) * _count);
+    NSFastEnumerationState state = {0};
+    NSUInteger copied = 0;
+    NSUInteger n;
+    while ((n = [self countByEnumeratingWithState:&state objects:NULL count:0]) > 0) {
+        memcpy((void *)(objects + copied), (void *)state.itemsPtr, sizeof(id) * n);
+        copied += n;
+    }
+    NSArray *result = [NSArray arrayWithObjects:objects count:copied];
+    free(objects);
+    return result;
+}
+
+- (NSEnumerator *)fnx_iterator
+{
+    return [FNXVectorEnumerator enumeratorWithVector:self];
+}
+
+@end
+
+
+@implementation FNXVectorEnumerator
+
++ (instancetype)enumeratorWithVector:(FNXVector *)vector
+{
+    FNXVectorEnumerator *result = [[self alloc] init];
+    result->_vector = vector;
+    return result;
+}
+
+- (id)nextObject
+{
+    if (_position == _available) {
+        _available = [_vector countByEnumeratingWithState:&_state objects:NULL count:0];
+        _position = 0;
+        if (0 == _available) {
+            return nil;
+        }
+    }
+    return _state.itemsPtr[_position++];
+}
+
+@end
+
+
+@implementation FNXVectorBuilder
+
++ (instancetype)builder
+{
+    return [[self alloc] init];
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _edit = [[NSObject alloc] init];
+        _root = FNXVectorNodeCopy(nil, _edit);
+        _tail = FNXVectorNodeCopy(nil, _edit);
+        _shift = FNXVectorBits;
+    }
+    return self;
+}
+
+- (void)addObject:(id)obj
+{
+    NSParameterAssert(nil != obj);
+    if (_count - FNXVectorTailOffset(_count) < FNXVectorWidth) {
+        _tail = FNXVectorEditableNode(_tail, _edit);
+        _tail->_slots[_count & FNXVectorMask] = obj;
+    } else {
+        FNXVectorPushTail(&_root, &_tail, &_shift, _count, obj, _edit);
+    }
+    _count += 1;
+}
+
+- (void)addObjectsFromCollection:(id<NSFastEnumeration>)collection
+{
+    for (id obj in collection) {
+        [self addObject:obj];
+    }
+}
+
+- (FNXVector *)vector
+{
+    FNXVector *result = [[FNXVector alloc] initWithRoot:_root
+                                                   tail:_tail
+                                                   size:_count
+                                                  shift:_shift
+                                                 origin:0
+                                                  count:_count];
+    // The vector now shares every node, so from here on the builder copies a node before changing it.
+    _edit = [[NSObject alloc] init];
+    return result;
+}
+
+@end
@@ -0,0 +1,73 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import <Foundation/Foundation.h>
+#import "FNXTraversable.h"
+
+
+// A lazy view over a collection.
+// Transformers (map, filter, drop, take, flatMap, ...) don't build intermediate collections; they are fused into a
+// single pipeline that is run in one pass over the underlying collection when a terminal operation (fold, find,
+// toArray, ...) is invoked. Short-circuiting terminals stop pulling from the underlying collection as soon as their
+// result is known.
+// The underlying collection is retained, not copied, so it must not be mutated while the view is in use.
+@interface FNXView : NSObject <FNXIterable>
+
+// Returns a view over the elements of collection.
++ (instancetype)viewWithCollection:(id<NSFastEnumeration>)collection;
+
+// Selects all elements except first n ones.
+- (FNXView *)fnx_drop:(NSUInteger)n;
+
+// Drops longest prefix of elements that satisfy a predicate.
+- (FNXView *)fnx_dropWhile:(BOOL (^)(id obj))pred;
+
+// Selects all elements of this collection which satisfy a predicate.
+- (FNXView *)fnx_filter:(BOOL (^)(id obj))pred;
+
+// Selects all elements of this collection which do not satisfy a predicate.
+- (FNXView *)fnx_filterNot:(BOOL (^)(id obj))pred;
+
+// Builds a new collection by applying a function to all elements of this collection
+// and using the elements of the resulting collections.
+- (FNXView *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn;
+
+// Applies a binary operator to a start value and the elements of this view, going left to right, also passing each
+// element's index. Setting *stop to YES ends the traversal after the current element, with the value op returned as the
+// result.
+- (id)fnx_foldLeftWhileWithStartValue:(id)startValue
+                                   op:(id (^)(id accumulator, id obj, NSUInteger idx, BOOL *stop))op;
+
+// Selects all elements except the last.
+// Unlike the strict collections, this doesn't raise for an empty view.
+- (FNXView *)fnx_init;
+
+// Builds a new collection by applying a function to all elements of this collection.
+// If fn could return nil, it must return [FNXNone none] instead and the other values
+// should be mapped as FNXSome values.
+- (FNXView *)fnx_map:(id (^)(id obj))fn;
+
+// Selects all elements except the first.
+// Unlike the strict collections, this doesn't raise for an empty view.
+- (FNXView *)fnx_tail;
+
+// Selects the first n elements.
+- (FNXView *)fnx_take:(NSUInteger)n;
+
+// Takes longest prefix of elements that satisfy a predicate.
+- (FNXView *)fnx_takeWhile:(BOOL (^)(id obj))pred;
+
+@end
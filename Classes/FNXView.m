@@ -0,0 +1,410 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import "FNXView.h"
+#import "FNXOption.h"
+#import "FNXSome.h"
+#import "FNXNone.h"
+#import "NSArray+FNXFunctionalExtensions.h"
+
+
+// Receives one element of the pipeline. Returns NO when no further elements are wanted.
+typedef BOOL (^FNXViewSink)(id obj);
+
+// Wraps the downstream sink of a pipeline with one transformation. Stages are invoked once per traversal, so any
+// state they need (counters, previous element, ...) is created fresh for each traversal.
+typedef FNXViewSink (^FNXViewStage)(FNXViewSink downstream);
+
+
+@interface FNXView ()
+
+@property (nonatomic, strong, readonly) id<NSFastEnumeration> collection;
+@property (nonatomic, copy, readonly) NSArray *stages;
+
+@end
+
+
+@implementation FNXView
+
++ (instancetype)viewWithCollection:(id<NSFastEnumeration>)collection
+{
+    return [[FNXView alloc] initWithCollection:collection stages:@[]];
+}
+
+- (instancetype)initWithCollection:(id<NSFastEnumeration>)collection stages:(NSArray *)stages
+{
+    NSParameterAssert(nil != collection);
+
+    self = [super init];
+    if (self) {
+        _collection = collection;
+        _stages = [stages copy];
+    }
+    return self;
+}
+
+// Returns a new view with stage appended to the end of this view's pipeline.
+- (FNXView *)viewByAppendingStage:(FNXViewStage)stage
+{
+    return [[FNXView alloc] initWithCollection:_collection stages:[_stages arrayByAddingObject:[stage copy]]];
+}
+
+// Runs every element of the underlying collection through the pipeline into sink, in a single pass.
+// Traversal stops as soon as any stage or sink returns NO.
+- (void)traverseWithSink:(FNXViewSink)sink
+{
+    FNXViewSink pipeline = sink;
+    for (FNXViewStage stage in _stages.reverseObjectEnumerator) {
+        pipeline = stage(pipeline);
+    }
+    for (id obj in _collection) {
+        if (!pipeline(obj)) {
+            break;
+        }
+    }
+}
+
+#pragma mark - NSObject
+
+- (NSString *)debugDescription
+{
+    return [NSString stringWithFormat:@"{ FNXView.collection: \"%@\", stages: %lu }",
+            [(id)_collection debugDescription], (unsigned long)_stages.count];
+}
+
+#pragma mark - FNXTraversableOnce
+
+// Counts the number of elements in the collection which satisfy a predicate.
+- (NSUInteger)fnx_count:(BOOL (^)(id obj))pred
+{
+    __block NSUInteger result = 0;
+    [self traverseWithSink:^BOOL(id obj) {
+        if (pred(obj)) {
+            result += 1;
+        }
+        return YES;
+    }];
+    return result;
+}
+
+// Tests whether a predicate holds for some of the elements of this traversable.
+- (BOOL)fnx_exists:(BOOL (^)(id obj))pred
+{
+    __block BOOL result = NO;
+    [self traverseWithSink:^BOOL(id obj) {
+        result = pred(obj);
+        return !result;
+    }];
+    return result;
+}
+
+// Selects all elements of this collection which satisfy a predicate.
+- (FNXView *)fnx_filter:(BOOL (^)(id obj))pred
+{
+    NSParameterAssert(nil != pred);
+    return [self viewByAppendingStage:^FNXViewSink(FNXViewSink downstream) {
+        return ^BOOL(id obj) {
+            return pred(obj) ? downstream(obj) : YES;
+        };
+    }];
+}
+
+// Finds the first element of the collection satisfying a predicate, if any.
+- (id<FNXOption>)fnx_find:(BOOL (^)(id obj))pred
+{
+    __block id result = nil;
+    [self traverseWithSink:^BOOL(id obj) {
+        if (pred(obj)) {
+            result = obj;
+            return NO;
+        }
+        return YES;
+    }];
+    return (nil != result) ? [FNXSome someWithValue:result] : [NSNull fnx_none];
+}
+
+// Applies a binary operator to a start value and all elements of this collection, going left to right.
+// op(...op(startValue, x_1), x_2, ..., x_n)
+- (id)fnx_foldLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op
+{
+    __block id accumulator = startValue;
+    [self traverseWithSink:^BOOL(id obj) {
+        accumulator = op(accumulator, obj);
+        return YES;
+    }];
+    return accumulator;
+}
+
+// Applies a binary operator to a start value and the elements of this view, going left to right, until op sets *stop
+// to YES.
+- (id)fnx_foldLeftWhileWithStartValue:(id)startValue
+                                   op:(id (^)(id accumulator, id obj, NSUInteger idx, BOOL *stop))op
+{
+    NSParameterAssert(nil != op);
+    __block id accumulator = startValue;
+    __block NSUInteger index = 0;
+    [self traverseWithSink:^BOOL(id obj) {
+        BOOL stop = NO;
+        accumulator = op(accumulator, obj, index++, &stop);
+        return !stop;
+    }];
+    return accumulator;
+}
+
+// Applies a binary operator to all elements of this iterable collection and a start value, going right to left.
+// op(x_1, op(x_2, ... op(x_n, z)...))
+- (id)fnx_foldRightWithStartValue:(id)startValue op:(id (^)(id obj, id accumulator))op
+{
+    // A right fold needs the last element first, so the view has to be forced.
+    return [self.fnx_toArray fnx_foldRightWithStartValue:startValue op:op];
+}
+
+// Tests whether a predicate holds for all elements of this collection.
+- (BOOL)fnx_forall:(BOOL (^)(id obj))pred
+{
+    __block BOOL result = YES;
+    [self traverseWithSink:^BOOL(id obj) {
+        result = pred(obj);
+        return result;
+    }];
+    return result;
+}
+
+// Apply the given procedure fn to every element in the collection.
+- (void)fnx_foreach:(void (^)(id obj))fn
+{
+    NSParameterAssert(nil != fn);
+    [self traverseWithSink:^BOOL(id obj) {
+        fn(obj);
+        return YES;
+    }];
+}
+
+// Tests whether this collection is empty.
+- (BOOL)fnx_isEmpty
+{
+    __block BOOL result = YES;
+    [self traverseWithSink:^BOOL(id obj) {
+        result = NO;
+        return NO;
+    }];
+    return result;
+}
+
+// Builds a new collection by applying a function to all elements of this collection.
+// If fn could return nil, it must return [FNXNone none] instead and the other values
+// should be mapped as FNXSome values.
+- (FNXView *)fnx_map:(id (^)(id obj))fn
+{
+    NSParameterAssert(nil != fn);
+    return [self viewByAppendingStage:^FNXViewSink(FNXViewSink downstream) {
+        return ^BOOL(id obj) {
+            return downstream(fn(obj));
+        };
+    }];
+}
+
+// The size of this collection.
+- (NSUInteger)fnx_size
+{
+    __block NSUInteger result = 0;
+    [self traverseWithSink:^BOOL(id obj) {
+        result += 1;
+        return YES;
+    }];
+    return result;
+}
+
+// Converts this traversable to an array.
+- (NSArray *)fnx_toArray
+{
+    NSMutableArray *result = [NSMutableArray array];
+    [self traverseWithSink:^BOOL(id obj) {
+        [result addObject:obj];
+        return YES;
+    }];
+    return [result copy];
+}
+
+#pragma mark - FNXTraversable
+
+// Selects all elements except first n ones.
+- (FNXView *)fnx_drop:(NSUInteger)n
+{
+    if (0 == n) {
+        return self;
+    }
+    return [self viewByAppendingStage:^FNXViewSink(FNXViewSink downstream) {
+        __block NSUInteger remaining = n;
+        return ^BOOL(id obj) {
+            if (remaining > 0) {
+                --remaining;
+                return YES;
+            }
+            return downstream(obj);
+        };
+    }];
+}
+
+// Drops longest prefix of elements that satisfy a predicate.
+- (FNXView *)fnx_dropWhile:(BOOL (^)(id obj))pred
+{
+    NSParameterAssert(nil != pred);
+    return [self viewByAppendingStage:^FNXViewSink(FNXViewSink downstream) {
+        __block BOOL dropping = YES;
+        return ^BOOL(id obj) {
+            dropping = dropping && pred(obj);
+            return dropping ? YES : downstream(obj);
+        };
+    }];
+}
+
+// Selects all elements of this collection which do not satisfy a predicate.
+- (FNXView *)fnx_filterNot:(BOOL (^)(id obj))pred
+{
+    NSParameterAssert(nil != pred);
+    return [self fnx_filter:^BOOL(id obj) {
+        return !pred(obj);
+    }];
+}
+
+// Builds a new collection by applying a function to all elements of this collection
+// and using the elements of the resulting collections.
+- (FNXView *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn
+{
+    NSParameterAssert(nil != fn);
+    return [self viewByAppendingStage:^FNXViewSink(FNXViewSink downstream) {
+        return ^BOOL(id obj) {
+            id<FNXTraversableOnce> inner = fn(obj);
+            // Stream the inner collection when possible rather than forcing it into an array.
+            id<NSFastEnumeration> elements = [inner conformsToProtocol:@protocol(NSFastEnumeration)]
+                ? (id<NSFastEnumeration>)inner
+                : inner.fnx_toArray;
+            for (id innerObj in elements) {
+                if (!downstream(innerObj)) {
+                    return NO;
+                }
+            }
+            return YES;
+        };
+    }];
+}
+
+// Selects the first element of this collection.
+- (id)fnx_head
+{
+    id<FNXOption> result = self.fnx_headOption;
+    if (result.fnx_isEmpty) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Head of empty view", @"Message when [FNXView head] is called")
+                                        userInfo:nil];
+    }
+    return result.fnx_get;
+}
+
+// Optionally selects the first element of this collection.
+- (id<FNXOption>)fnx_headOption
+{
+    return [self fnx_find:^BOOL(id obj) {
+        return YES;
+    }];
+}
+
+// Selects all elements except the last.
+- (FNXView *)fnx_init
+{
+    return [self viewByAppendingStage:^FNXViewSink(FNXViewSink downstream) {
+        // Hold each element back until the next one arrives, so the last one is never emitted.
+        __block id previous = nil;
+        return ^BOOL(id obj) {
+            BOOL more = (nil == previous) || downstream(previous);
+            previous = obj;
+            return more;
+        };
+    }];
+}
+
+// Selects the last element.
+- (id)fnx_last
+{
+    id<FNXOption> result = self.fnx_lastOption;
+    if (result.fnx_isEmpty) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Last of empty view", @"Message when [FNXView last] is called")
+                                        userInfo:nil];
+    }
+    return result.fnx_get;
+}
+
+// Optionally selects the last element.
+- (id<FNXOption>)fnx_lastOption
+{
+    __block id result = nil;
+    [self traverseWithSink:^BOOL(id obj) {
+        result = obj;
+        return YES;
+    }];
+    return (nil != result) ? [FNXSome someWithValue:result] : [NSNull fnx_none];
+}
+
+// Tests whether the collection is not empty.
+- (BOOL)fnx_nonEmpty
+{
+    return !self.fnx_isEmpty;
+}
+
+// Selects all elements except the first.
+- (FNXView *)fnx_tail
+{
+    return [self fnx_drop:1];
+}
+
+// Selects the first n elements.
+- (FNXView *)fnx_take:(NSUInteger)n
+{
+    return [self viewByAppendingStage:^FNXViewSink(FNXViewSink downstream) {
+        __block NSUInteger remaining = n;
+        return ^BOOL(id obj) {
+            if (0 == remaining) {
+                return NO;
+            }
+            --remaining;
+            // Stop right after the nth element rather than pulling one more from upstream.
+            return downstream(obj) && remaining > 0;
+        };
+    }];
+}
+
+// Takes longest prefix of elements that satisfy a predicate.
+- (FNXView *)fnx_takeWhile:(BOOL (^)(id obj))pred
+{
+    NSParameterAssert(nil != pred);
+    return [self viewByAppendingStage:^FNXViewSink(FNXViewSink downstream) {
+        return ^BOOL(id obj) {
+            return pred(obj) && downstream(obj);
+        };
+    }];
+}
+
+#pragma mark - FNXIterable
+
+// Returns an iterator for elements in this collection
+- (NSEnumerator *)fnx_iterator
+{
+    return self.fnx_toArray.objectEnumerator;
+}
+
+@end
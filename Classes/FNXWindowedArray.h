@@ -0,0 +1,28 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Foundation/Foundation.h>
+
+
+// An immutable array of the windows of another array, each of them an array of up to size consecutive elements.
+// The windows start every step elements; the last one is shorter when there aren't enough elements left to fill it.
+// Each window is a slice backed by the source array, created when it's accessed, so no elements are copied.
+@interface FNXWindowedArray : NSArray
+
+// Returns the windows of size elements of array, starting every step elements.
+// Raises NSInvalidArgumentException if size or step is 0.
++ (NSArray *)arrayWithWindowsOfArray:(NSArray *)array size:(NSUInteger)size step:(NSUInteger)step;
+
+@end
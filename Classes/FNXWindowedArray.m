@@ -0,0 +1,90 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import "FNXWindowedArray.h"
+#import "FNXArraySlice.h"
+
+
+@implementation FNXWindowedArray
+{
+    NSArray *_array;
+    NSUInteger _size;
+    NSUInteger _step;
+    NSUInteger _count;
+}
+
++ (NSArray *)arrayWithWindowsOfArray:(NSArray *)array size:(NSUInteger)size step:(NSUInteger)step
+{
+    NSParameterAssert(nil != array);
+    if (0 == size || 0 == step) {
+        @throw [[NSException alloc] initWithName:NSInvalidArgumentException
+                                          reason:NSLocalizedString(@"Window size and step must be positive", @"Message when [FNXWindowedArray arrayWithWindowsOfArray:size:step:] is called with a size or step of 0")
+                                        userInfo:nil];
+    }
+    NSUInteger length = array.count;
+    if (0 == length) {
+        return [NSArray array];
+    }
+    NSUInteger count;
+    if (step >= size) {
+        // Windows don't overlap, so there is one for every start k * step that lies inside the array.
+        count = (length + step - 1) / step;
+    } else {
+        // The first window is always there; each further one needs at least one element the previous windows don't
+        // cover.
+        count = (length <= size) ? 1 : 1 + (length - size + step - 1) / step;
+    }
+    return [[FNXWindowedArray alloc] initWithArray:[array copy] size:size step:step count:count];
+}
+
+- (instancetype)initWithArray:(NSArray *)array size:(NSUInteger)size step:(NSUInteger)step count:(NSUInteger)count
+{
+    self = [super init];
+    if (self) {
+        _array = array;
+        _size = size;
+        _step = step;
+        _count = count;
+    }
+    return self;
+}
+
+#pragma mark - NSArray
+
+- (NSUInteger)count
+{
+    return _count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+    if (index >= _count) {
+        @throw [[NSException alloc] initWithName:NSRangeException
+                                          reason:NSLocalizedString(@"Index out of bounds", @"Message when [FNXWindowedArray objectAtIndex:] is called with a bad index")
+                                        userInfo:nil];
+    }
+    NSUInteger location = index * _step;
+    return [FNXArraySlice sliceWithArray:_array range:NSMakeRange(location, MIN(_size, _array.count - location))];
+}
+
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    // Windowed arrays are immutable.
+    return self;
+}
+
+@end
@@ -0,0 +1,37 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import <Foundation/Foundation.h>
+
+
+// An immutable array of FNXTuple2 pairs that is stored as two arrays, one per component.
+// The pair at an index is only allocated when it's accessed, so zipping two arrays takes constant time and
+// fnx_unzip on a zipped array returns the component arrays without creating any pairs.
+@interface FNXZippedArray : NSArray
+
+// The first components of the pairs.
+@property (nonatomic, strong, readonly) NSArray *firsts;
+
+// The second components of the pairs.
+@property (nonatomic, strong, readonly) NSArray *seconds;
+
+// Returns the pairs (first[i], second[i]). The result is as long as the shorter of the two arrays.
++ (NSArray *)arrayByZipping:(NSArray *)first with:(NSArray *)second;
+
+// Returns the pairs (array[i], @(i)).
++ (NSArray *)arrayByZippingWithIndex:(NSArray *)array;
+
+@end
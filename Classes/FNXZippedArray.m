@@ -0,0 +1,99 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import "FNXZippedArray.h"
+#import "FNXArraySlice.h"
+#import "FNXTuple2.h"
+
+
+@implementation FNXZippedArray
+{
+    NSArray *_first;
+    // nil when the second components are the indexes.
+    NSArray *_second;
+    NSUInteger _count;
+}
+
++ (NSArray *)arrayByZipping:(NSArray *)first with:(NSArray *)second
+{
+    NSParameterAssert(nil != first);
+    NSParameterAssert(nil != second);
+    return [[FNXZippedArray alloc] initWithFirst:[first copy]
+                                          second:[second copy]
+                                           count:MIN(first.count, second.count)];
+}
+
++ (NSArray *)arrayByZippingWithIndex:(NSArray *)array
+{
+    NSParameterAssert(nil != array);
+    return [[FNXZippedArray alloc] initWithFirst:[array copy] second:nil count:array.count];
+}
+
+- (instancetype)initWithFirst:(NSArray *)first second:(NSArray *)second count:(NSUInteger)count
+{
+    self = [super init];
+    if (self) {
+        _first = first;
+        _second = second;
+        _count = count;
+    }
+    return self;
+}
+
+- (NSArray *)firsts
+{
+    return [FNXArraySlice sliceWithArray:_first range:NSMakeRange(0, _count)];
+}
+
+- (NSArray *)seconds
+{
+    if (nil != _second) {
+        return [FNXArraySlice sliceWithArray:_second range:NSMakeRange(0, _count)];
+    }
+    NSMutableArray *indexes = [NSMutableArray arrayWithCapacity:_count];
+    for (NSUInteger i = 0; i < _count; ++i) {
+        [indexes addObject:@(i)];
+    }
+    return [indexes copy];
+}
+
+#pragma mark - NSArray
+
+- (NSUInteger)count
+{
+    return _count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+    if (index >= _count) {
+        @throw [[NSException alloc] initWithName:NSRangeException
+                                          reason:NSLocalizedString(@"Index out of bounds", @"Message when [FNXZippedArray objectAtIndex:] is called with a bad index")
+                                        userInfo:nil];
+    }
+    id second = (nil != _second) ? _second[index] : @(index);
+    return [FNXTuple2 tuple2With_1:_first[index] _2:second];
+}
+
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    // Zipped arrays are immutable.
+    return self;
+}
+
+@end
@@ -19,6 +19,19 @@
 #import "FNXNone.h"
 #import "FNXSome.h"
 #import "FNXTuple2.h"
+#import "FNXArraySlice.h"
+#import "FNXZippedArray.h"
+#import "FNXWindowedArray.h"
+#import "FNXMemo.h"
+#import "FNXFuture.h"
+#import "FNXVector.h"
+#import "FNXInt64Array.h"
+#import "FNXDoubleArray.h"
+#import "FNXStats.h"
+#import "FNXLazyEnumerator.h"
+#import "FNXParallel.h"
+#import "FNXAutoreleaseBatching.h"
+#import "FNXView.h"
 #import "NSArray+FNXFunctionalExtensions.h"
 #import "NSDictionary+FNXFunctionalExtensions.h"
 #import "NSEnumerator+FNXFunctionalExtensions.h"
@@ -17,45 +17,99 @@
 #import <Foundation/Foundation.h>
 #import "FNXTraversable.h"
 
+@class FNXFuture;
 @class FNXTuple2;
+@class FNXView;
+
+
+// Summary statistics of a collection of numbers.
+typedef struct {
+    NSUInteger count;
+    double sum;
+    double min;
+    double max;
+    double mean;
+    // The population variance.
+    double variance;
+} FNXNumericStats;
 
 
 // Scala-style functional extensions for NSArray.
+// The methods that select a contiguous range of elements (drop, dropRight, dropWhile, init, slice, splitAt, tail, take
+// and takeRight) return FNXArraySlice objects, which share this array's storage instead of copying it.
 @interface NSArray (FNXFunctionalExtensions) <FNXIterable>
 
+// Set operations. They preserve the order of the elements, keep the first of equal elements, and return arrays without
+// duplicates. Unlike the multiset diff and intersect of Scala sequences, the multiplicity of the elements isn't kept.
+
+// Returns the elements of this collection that aren't in other.
+- (NSArray *)fnx_diff:(NSArray *)other;
+
 // Builds a new array from this collection without any duplicate elements.
 - (NSArray *)fnx_distinct;
 
+// Builds a new array from this collection without any elements whose key, as computed by fn, is a duplicate.
+// The first element with each key is kept.
+- (NSArray *)fnx_distinctBy:(id (^)(id obj))fn;
+
 // Selects all elements except last n ones.
 - (NSArray *)fnx_dropRight:(NSUInteger)n;
 
 // Drops longest prefix of elements that satisfy a predicate.
 - (NSArray *)fnx_dropWhile:(BOOL (^)(id obj))pred;
 
+// Selects all elements of this collection for which pred returns YES.
+// pred must be a method on the element that takes no arguments and returns BOOL.
+- (NSArray *)fnx_filterWithSelector:(SEL)pred;
+
+// Finds the first element of the collection satisfying a predicate, or nil if there is none.
+// Unlike fnx_find:, this doesn't allocate an option for the result.
+- (id)fnx_findValue:(BOOL (^)(id obj))pred;
+
 // Builds a new collection by applying a function to all elements of this collection
 // and using the elements of the resulting collections.
 - (NSArray *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn;
 
+// Applies a binary operator to a start value and the elements of this collection, going left to right, like
+// fnx_foldLeftWithStartValue:op:, also passing each element's index. Setting *stop to YES ends the fold after the
+// current element, with the value op returned as the result.
+- (id)fnx_foldLeftWhileWithStartValue:(id)startValue
+                                   op:(id (^)(id accumulator, id obj, NSUInteger idx, BOOL *stop))op;
+
 // Invokes pred for elements of this collection. Returns NO if any results return NO; YES, otherwise.
 // pred must be a method on the element that takes no arguments and returns BOOL.
 - (BOOL)fnx_forallWithSelector:(SEL)pred;
 
 // Invokes fn for elements of this collection.
 // fn must be a method on the element that takes no arguments and returns void.
+// Like the other selector-based operators, the method is looked up again only when the class of the element changes,
+// so homogeneous collections resolve it once.
 - (void)fnx_foreachWithSelector:(SEL)fn;
 
-//// Applies a function fn to all elements of this collection in _parallel_.
-//- (void)fnx_foreachParallel:(void (^)(id obj))fn;
+// Applies a function fn to all elements of this collection and their indexes.
+- (void)fnx_foreachWithIndex:(void (^)(id obj, NSUInteger idx))fn;
+
+// Partitions this collection into consecutive groups of n elements; the last group is shorter when the elements don't
+// divide evenly. The groups are views of this collection, so no elements are copied.
+// Raises NSInvalidArgumentException if n is 0.
+- (NSArray *)fnx_grouped:(NSUInteger)n;
 
 // Partitions this collection into a dictionary of collections according to some discriminator function, fn. The
 // discriminator function should return an object representing which bucket the object must be placed into and that will
 // be used as a key in the resultant dictionary.
 - (NSDictionary *)fnx_groupBy:(id (^)(id obj))fn;
 
-//// Builds a new collection by applying a function to all elements of this array in _parallel_.
-//// If fn could return nil, it must return [FNXNone none] instead and the other values
-//// should be mapped as FNXSome values.
-//- (NSArray *)fnx_mapParallel:(id (^)(id obj))fn;
+// Partitions this collection according to the discriminator function fn, like fnx_groupBy:, but reduces each bucket
+// with op as it goes instead of collecting the bucket's elements. The first element of each bucket is the bucket's
+// initial accumulator. Returns a dictionary from each key to the reduced value of its bucket.
+- (NSDictionary *)fnx_groupBy:(id (^)(id obj))fn reduce:(id (^)(id accumulator, id obj))op;
+
+// Returns the elements of this collection that are also in other.
+- (NSArray *)fnx_intersect:(NSArray *)other;
+
+// Builds a new collection by applying a function to all elements of this collection, invoking fn once per distinct
+// element (by isEqual:). Worthwhile when fn is expensive and the elements repeat. fn must not return nil.
+- (NSArray *)fnx_mapMemoized:(id (^)(id obj))fn;
 
 // Builds a new collection by applying a function to all elements of this collection.
 // If fn could return nil, it must return [FNXNone none] instead and the other values
@@ -63,19 +117,242 @@
 // The FNXTuple2 object returned from fn should have _1 as the key and _2 as the value.
 - (NSDictionary *)fnx_mapToDictionary:(FNXTuple2 *(^)(id obj))fn;
 
+// Builds a new collection from the results of invoking fn on all elements of this collection.
+// fn must be a method on the element that takes no arguments and returns an object.
+- (NSArray *)fnx_mapWithSelector:(SEL)fn;
+
+// Finds the first element which yields the largest key, as computed by fn and ordered by compare:.
+// Each key is computed once. Raises FNXUnsupportedOperation for an empty collection.
+- (id)fnx_maxBy:(id (^)(id obj))fn;
+
+// Finds the first element which yields the smallest key, as computed by fn and ordered by compare:.
+// Each key is computed once. Raises FNXUnsupportedOperation for an empty collection.
+- (id)fnx_minBy:(id (^)(id obj))fn;
+
 // Displays all elements of this list in a string.
 - (NSString *)fnx_mkString;
 
 // Displays all elements of this list in a string using a separator string.
 - (NSString *)fnx_mkString:(NSString *)sep;
 
+// Displays all elements of this list in a string using start, end, and separator strings.
+- (NSString *)fnx_mkStringWithStart:(NSString *)start sep:(NSString *)sep end:(NSString *)end;
+
+// Writes all elements of this list to a file descriptor as a UTF-8 string using start, end, and separator strings.
+// The string is written in chunks as it's built, so it's never held in memory as a whole.
+// Returns NO and sets error if writing fails.
+- (BOOL)fnx_mkStringToFileDescriptor:(int)fileDescriptor
+                               start:(NSString *)start
+                                 sep:(NSString *)sep
+                                 end:(NSString *)end
+                               error:(NSError **)error;
+
+// Writes all elements of this list to an open output stream as a UTF-8 string using start, end, and separator
+// strings. The string is written in chunks as it's built, so it's never held in memory as a whole.
+// Returns NO and sets error if writing fails.
+- (BOOL)fnx_mkStringToStream:(NSOutputStream *)stream
+                       start:(NSString *)start
+                         sep:(NSString *)sep
+                         end:(NSString *)end
+                       error:(NSError **)error;
+
 // Returns a new collection with the elements of this collection in reversed order.
 - (NSArray *)fnx_reverse;
 
+// Produces the running accumulations of op over this collection, going left to right: the start value, followed by
+// op(startValue, x_1), op(op(startValue, x_1), x_2), and so on.
+- (NSArray *)fnx_scanLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op;
+
+// Selects the elements in range. The range is clipped to the bounds of this collection.
+- (NSArray *)fnx_slice:(NSRange)range;
+
+// Returns the windows of size consecutive elements of this collection, starting every step elements; the last window
+// is shorter when there aren't enough elements left to fill it. The windows are views of this collection, so no
+// elements are copied.
+// Raises NSInvalidArgumentException if size or step is 0.
+- (NSArray *)fnx_sliding:(NSUInteger)size step:(NSUInteger)step;
+
+// Sorts this collection by the keys computed by fn, ordered by compare:. The sort is stable.
+// Each key is computed once, rather than on both sides of every comparison.
+- (NSArray *)fnx_sortBy:(id (^)(id obj))fn;
+
+// Sorts this collection with comparator, a method on the elements that takes another element and returns an
+// NSComparisonResult, such as compare:. The sort is stable.
+- (NSArray *)fnx_sortWithSelector:(SEL)comparator;
+
+// Splits this collection into two at a given position.
+// Returns a pair whose _1 is the first n elements and whose _2 is the remaining elements.
+- (FNXTuple2 *)fnx_splitAt:(NSUInteger)n;
+
+// Selects the first n elements.
+- (NSArray *)fnx_take:(NSUInteger)n;
+
+// Selects the last n elements.
+- (NSArray *)fnx_takeRight:(NSUInteger)n;
+
 // Returns a dictionary assuming that this collection contains elements that are FNXTuple2 objects, where _1 is the
 // key and _2 is the value.
 - (NSDictionary *)fnx_toDictionary;
 
+// Selects the k elements which yield the largest keys, as computed by fn and ordered by compare:, from the largest key
+// down. Of elements with equal keys, the earlier ones are preferred.
+// Only k elements are kept at a time, in a heap, so this is cheaper than sorting the whole collection when k is small.
+- (NSArray *)fnx_topK:(NSUInteger)k by:(id (^)(id obj))fn;
+
+// Returns the elements of this collection followed by the elements of other, without duplicates.
+- (NSArray *)fnx_union:(NSArray *)other;
+
+// Converts this collection of FNXTuple2 pairs into a pair of arrays of their first and second components.
+- (FNXTuple2 *)fnx_unzip;
+
+// Returns a lazy view of this collection, whose transformers are fused into a single pass.
+- (FNXView *)fnx_view;
+
+// Returns an array of FNXTuple2 pairs of corresponding elements of this collection and other, as long as the shorter
+// of the two. The result is an FNXZippedArray, so the pairs are only allocated when they're accessed.
+- (NSArray *)fnx_zip:(NSArray *)other;
+
+// Builds a new collection by applying a function to corresponding elements of this collection and other, without
+// creating pairs. The result is as long as the shorter of the two.
+- (NSArray *)fnx_zip:(NSArray *)other with:(id (^)(id obj1, id obj2))fn;
+
+// Returns an array of FNXTuple2 pairs of each element of this collection and its index as an NSNumber.
+// The result is an FNXZippedArray, so the pairs are only allocated when they're accessed.
+- (NSArray *)fnx_zipWithIndex;
+
+@end
+
+
+// Data-parallel operators. The array is split into contiguous chunks (see FNXParallel) which are processed
+// concurrently, so the blocks passed in must be safe to call from several threads at once.
+// A grainSize of 0 uses [FNXParallel defaultGrainSize].
+@interface NSArray (FNXParallel)
+
+// Counts the number of elements in the collection which satisfy a predicate, in _parallel_.
+- (NSUInteger)fnx_countParallel:(BOOL (^)(id obj))pred;
+
+// Returns the elements of this collection that aren't in other, like fnx_diff:, testing membership in _parallel_.
+- (NSArray *)fnx_diffParallel:(NSArray *)other;
+
+// Builds a new array from this collection without any elements whose key is a duplicate, like fnx_distinctBy:,
+// computing the keys in _parallel_. Worthwhile when fn is expensive.
+- (NSArray *)fnx_distinctByParallel:(id (^)(id obj))fn;
+
+// Tests whether a predicate holds for some of the elements of this collection, in _parallel_.
+// Stops evaluating the predicate soon after a match is found.
+- (BOOL)fnx_existsParallel:(BOOL (^)(id obj))pred;
+
+// Selects all elements of this collection which satisfy a predicate, in _parallel_. Preserves the order of the elements.
+- (NSArray *)fnx_filterParallel:(BOOL (^)(id obj))pred;
+
+// Selects all elements of this collection which satisfy a predicate, in _parallel_, grainSize elements per task.
+- (NSArray *)fnx_filterParallel:(BOOL (^)(id obj))pred grainSize:(NSUInteger)grainSize;
+
+// Tests whether a predicate holds for all elements of this collection, in _parallel_.
+// Stops evaluating the predicate soon after an element fails it.
+- (BOOL)fnx_forallParallel:(BOOL (^)(id obj))pred;
+
+// Applies a function fn to all elements of this collection in _parallel_.
+- (void)fnx_foreachParallel:(void (^)(id obj))fn;
+
+// Applies a function fn to all elements of this collection in _parallel_, grainSize elements per task.
+- (void)fnx_foreachParallel:(void (^)(id obj))fn grainSize:(NSUInteger)grainSize;
+
+// Partitions this collection into a dictionary of collections according to some discriminator function, fn, in
+// _parallel_. Each chunk is grouped separately and the partial buckets are merged in chunk order, so the elements of
+// each bucket keep their original order.
+- (NSDictionary *)fnx_groupByParallel:(id (^)(id obj))fn;
+
+// Partitions this collection according to the discriminator function fn and reduces each bucket with op, in
+// _parallel_. Partial accumulators of the same bucket are combined with op in chunk order, so op must be associative.
+- (NSDictionary *)fnx_groupByParallel:(id (^)(id obj))fn reduce:(id (^)(id accumulator, id obj))op;
+
+// Returns the elements of this collection that are also in other, like fnx_intersect:, testing membership in
+// _parallel_.
+- (NSArray *)fnx_intersectParallel:(NSArray *)other;
+
+// Partitions this collection into groups of n elements, like fnx_grouped:, and applies fn to every group in
+// _parallel_, one group per task. The results are in the order of the groups.
+- (NSArray *)fnx_mapGroupedParallel:(NSUInteger)n fn:(id (^)(NSArray *group))fn;
+
+// Builds a new collection by applying a function to all elements of this array in _parallel_.
+// If fn could return nil, it must return [FNXNone none] instead and the other values
+// should be mapped as FNXSome values.
+- (NSArray *)fnx_mapParallel:(id (^)(id obj))fn;
+
+// Builds a new collection by applying a function to all elements of this array in _parallel_, grainSize elements per
+// task.
+- (NSArray *)fnx_mapParallel:(id (^)(id obj))fn grainSize:(NSUInteger)grainSize;
+
+// Builds a dictionary by applying a function to all elements of this collection, in _parallel_.
+// The FNXTuple2 object returned from fn should have _1 as the key and _2 as the value. As with fnx_mapToDictionary:,
+// when several elements map to the same key the last of them wins.
+- (NSDictionary *)fnx_mapToDictionaryParallel:(FNXTuple2 *(^)(id obj))fn;
+
+// Reduces the elements of this collection using an associative binary operator, in _parallel_.
+// Each chunk is reduced from left to right and the partial results are then combined from left to right, so op
+// needn't be commutative. Raises if the collection is empty.
+- (id)fnx_reduceParallel:(id (^)(id accumulator, id obj))op;
+
+// Sorts this collection by the keys computed by fn, like fnx_sortBy:, in _parallel_. The keys are computed and
+// the chunks are sorted concurrently, then the sorted runs are merged pairwise. The sort is stable.
+- (NSArray *)fnx_sortByParallel:(id (^)(id obj))fn;
+
+@end
+
+
+// Asynchronous operators, for blocks that wait on I/O rather than compute. The results are delivered as an FNXFuture
+// of an array in the order of the elements, and at most maxConcurrent elements are in flight at once.
+@interface NSArray (FNXAsync)
+
+// Runs fn on every element of this collection on queue, or the default global queue if queue is nil, at most
+// maxConcurrent at a time. The result fails if fn returns nil for any element. Cancelling it keeps the elements that
+// haven't started from running. Raises NSInvalidArgumentException if maxConcurrent is 0.
+- (FNXFuture *)fnx_mapAsync:(id (^)(id obj))fn maxConcurrent:(NSUInteger)maxConcurrent queue:(dispatch_queue_t)queue;
+
+// Collects the values of the futures fn returns for every element of this collection. All the elements are passed to
+// fn at once; fn is expected to start asynchronous work rather than block. The first failure fails the result.
+- (FNXFuture *)fnx_traverseAsync:(FNXFuture *(^)(id obj))fn;
+
+// Collects the values of the futures fn returns for every element of this collection, with at most maxConcurrent of
+// them pending at once.
+- (FNXFuture *)fnx_traverseAsync:(FNXFuture *(^)(id obj))fn maxConcurrent:(NSUInteger)maxConcurrent;
+
+@end
+
+
+// Variants of the sequential operators that drain an inner autorelease pool every batchSize elements, so the
+// temporaries the block autoreleases don't pile up over a long array. A batchSize of 0 uses
+// [FNXAutoreleaseBatching defaultBatchSize], and no inner pool if that's 0 too.
+@interface NSArray (FNXAutoreleaseBatching)
+
+- (id)fnx_foldLeftWithStartValue:(id)startValue
+                              op:(id (^)(id accumulator, id obj))op
+                autoreleaseEvery:(NSUInteger)batchSize;
+
+- (void)fnx_foreach:(void (^)(id obj))fn autoreleaseEvery:(NSUInteger)batchSize;
+
+- (NSDictionary *)fnx_groupBy:(id (^)(id obj))fn autoreleaseEvery:(NSUInteger)batchSize;
+
+- (NSArray *)fnx_map:(id (^)(id obj))fn autoreleaseEvery:(NSUInteger)batchSize;
+
+@end
+
+
+// Numeric reductions that return C scalars. The elements must respond to doubleValue, as NSNumber does; their values
+// are unboxed into a contiguous buffer once and reduced without any further message sends.
+@interface NSArray (FNXNumeric)
+
+// The smallest and largest values in this collection. Raises if the collection is empty.
+- (void)fnx_minMax:(double *)min max:(double *)max;
+
+// Computes the count, sum, min, max, mean and variance of this collection in a single pass.
+// min, max, mean and variance are NAN for an empty collection.
+- (FNXNumericStats)fnx_stats;
+
+// The sum of all elements in this collection, as a double.
+- (double)fnx_sumDouble;
+
 @end
 
 
@@ -20,116 +20,1301 @@
 #import "FNXSome.h"
 #import "FNXNone.h"
 #import "FNXTuple2.h"
+#import "FNXArraySlice.h"
+#import "FNXZippedArray.h"
+#import "FNXWindowedArray.h"
+#import "FNXMemo.h"
+#import "FNXFuture.h"
+#import "FNXView.h"
+#import "FNXParallel.h"
+#import "FNXAutoreleaseBatching.h"
+#import "FNXInstrumentation.h"
+#include <errno.h>
+#include <objc/runtime.h>
+#include <unistd.h>
 
 
+// Returns an immutable copy of a dictionary of mutable arrays, with each bucket also made immutable.
+static NSDictionary *FNXImmutableBuckets(NSDictionary *buckets)
+{
+    NSUInteger count = buckets.count;
+    __strong id *keys = (__strong id *)calloc(MAX(count, (NSUInteger)1), sizeof(id));
+    __strong id *values = (__strong id *)calloc(MAX(count, (NSUInteger)1), sizeof(id));
+    __block NSUInteger i = 0;
+    [buckets enumerateKeysAndObjectsUsingBlock:^(id key, NSMutableArray *bucket, BOOL *stop) {
+        keys[i] = key;
+        values[i] = [bucket copy];
+        ++i;
+    }];
+    NSDictionary *result = [NSDictionary dictionaryWithObjects:values forKeys:keys count:count];
+    for (i = 0; i < count; ++i) {
+        keys[i] = nil;
+        values[i] = nil;
+    }
+    free(keys);
+    free(values);
+    return result;
+}
+
+
+// The kinds of unboxed values a collection of NSNumber objects can be reduced as.
+typedef NS_ENUM(NSInteger, FNXNumericKind) {
+    // Not a collection of plain NSNumber objects, e.g. it holds NSDecimalNumber objects or other classes.
+    FNXNumericKindNone,
+    // Every value fits in an int64_t.
+    FNXNumericKindInteger,
+    // At least one value is a floating point number.
+    FNXNumericKindDouble,
+};
+
+// Determines how the objects can be reduced without boxing, from their objCType.
+static FNXNumericKind FNXNumericKindOfObjects(__unsafe_unretained id *objects, NSUInteger count)
+{
+    Class numberClass = [NSNumber class];
+    Class decimalNumberClass = [NSDecimalNumber class];
+    FNXNumericKind result = FNXNumericKindInteger;
+    for (NSUInteger i = 0; i < count; ++i) {
+        id obj = objects[i];
+        if (![obj isKindOfClass:numberClass] || [obj isKindOfClass:decimalNumberClass]) {
+            return FNXNumericKindNone;
+        }
+        switch ([obj objCType][0]) {
+            case 'c': case 'C': case 's': case 'S': case 'i': case 'I': case 'l': case 'q': case 'B':
+                break;
+            case 'L': case 'Q':
+                if ([obj unsignedLongLongValue] > INT64_MAX) {
+                    return FNXNumericKindNone;
+                }
+                break;
+            case 'f': case 'd':
+                result = FNXNumericKindDouble;
+                break;
+            default:
+                return FNXNumericKindNone;
+        }
+    }
+    return result;
+}
+
+// Returns a malloc'ed buffer of the objects' int64_t values.
+static int64_t *FNXCopyInt64Values(__unsafe_unretained id *objects, NSUInteger count)
+{
+    int64_t *values = (int64_t *)malloc(MAX(count, (NSUInteger)1) * sizeof(int64_t));
+    for (NSUInteger i = 0; i < count; ++i) {
+        values[i] = [objects[i] longLongValue];
+    }
+    return values;
+}
+
+// Returns a malloc'ed buffer of the objects' double values.
+static double *FNXCopyDoubleValues(__unsafe_unretained id *objects, NSUInteger count)
+{
+    double *values = (double *)malloc(MAX(count, (NSUInteger)1) * sizeof(double));
+    for (NSUInteger i = 0; i < count; ++i) {
+        values[i] = [objects[i] doubleValue];
+    }
+    return values;
+}
+
+// Returns the indexes of the smallest and largest values. count must be positive.
+static void FNXInt64IndexesOfMinMax(const int64_t *values, NSUInteger count, NSUInteger *minIndex, NSUInteger *maxIndex)
+{
+    NSUInteger lo = 0;
+    NSUInteger hi = 0;
+    for (NSUInteger i = 1; i < count; ++i) {
+        if (values[i] < values[lo]) {
+            lo = i;
+        }
+        if (values[i] > values[hi]) {
+            hi = i;
+        }
+    }
+    *minIndex = lo;
+    *maxIndex = hi;
+}
+
+// Returns the indexes of the smallest and largest values. count must be positive.
+static void FNXDoubleIndexesOfMinMax(const double *values, NSUInteger count, NSUInteger *minIndex, NSUInteger *maxIndex)
+{
+    NSUInteger lo = 0;
+    NSUInteger hi = 0;
+    for (NSUInteger i = 1; i < count; ++i) {
+        if (values[i] < values[lo]) {
+            lo = i;
+        }
+        if (values[i] > values[hi]) {
+            hi = i;
+        }
+    }
+    *minIndex = lo;
+    *maxIndex = hi;
+}
+
+// Sums the values into *sum. Returns NO if the sum overflows an int64_t.
+static BOOL FNXSumInt64Values(const int64_t *values, NSUInteger count, int64_t *sum)
+{
+    if (0 == count) {
+        *sum = 0;
+        return YES;
+    }
+    NSUInteger minIndex, maxIndex;
+    FNXInt64IndexesOfMinMax(values, count, &minIndex, &maxIndex);
+    // When no value is large enough to overflow the sum, a plain loop that the compiler can vectorize is used.
+    uint64_t largest = MAX(values[maxIndex] < 0 ? 0 : (uint64_t)values[maxIndex],
+                           values[minIndex] < 0 ? (uint64_t)-(values[minIndex] + 1) + 1 : 0);
+    int64_t result = 0;
+    if (largest <= (uint64_t)INT64_MAX / count) {
+        for (NSUInteger i = 0; i < count; ++i) {
+            result += values[i];
+        }
+    } else {
+        for (NSUInteger i = 0; i < count; ++i) {
+            if (__builtin_add_overflow(result, values[i], &result)) {
+                return NO;
+            }
+        }
+    }
+    *sum = result;
+    return YES;
+}
+
+// Returns the smallest or largest NSNumber of the array without boxing, or nil when the array isn't a homogeneous
+// collection of plain NSNumber objects. The array must not be empty.
+static NSNumber *FNXNumericExtremum(NSArray *array, BOOL largest)
+{
+    NSUInteger count = array.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [array getObjects:objects range:NSMakeRange(0, count)];
+    NSNumber *result = nil;
+    NSUInteger minIndex, maxIndex;
+    switch (FNXNumericKindOfObjects(objects, count)) {
+        case FNXNumericKindInteger: {
+            int64_t *values = FNXCopyInt64Values(objects, count);
+            FNXInt64IndexesOfMinMax(values, count, &minIndex, &maxIndex);
+            result = objects[largest ? maxIndex : minIndex];
+            free(values);
+            break;
+        }
+        case FNXNumericKindDouble: {
+            double *values = FNXCopyDoubleValues(objects, count);
+            FNXDoubleIndexesOfMinMax(values, count, &minIndex, &maxIndex);
+            result = objects[largest ? maxIndex : minIndex];
+            free(values);
+            break;
+        }
+        case FNXNumericKindNone:
+            break;
+    }
+    free(objects);
+    return result;
+}
+
+
+// The number of bytes the streaming fnx_mkString variants buffer before writing.
+static const NSUInteger FNXStringChunkSize = 64 * 1024;
+
+typedef BOOL (^FNXByteWriter)(const uint8_t *bytes, NSUInteger length);
+
+// Returns the string fnx_mkString uses for an element; the same text as the %@ format specifier.
+static NSString *FNXStringForElement(id obj)
+{
+    return [obj isKindOfClass:[NSString class]] ? obj : [obj description];
+}
+
+// Joins the elements of array into a single string. The elements are converted to strings once and their lengths
+// summed so that the characters are copied into a buffer of the right size, without any format parsing.
+static NSString *FNXJoinedString(NSArray *array, NSString *start, NSString *sep, NSString *end)
+{
+    start = start ?: @"";
+    sep = sep ?: @"";
+    end = end ?: @"";
+    NSUInteger count = array.count;
+    __strong NSString **strings = (__strong NSString **)calloc(MAX(count, (NSUInteger)1), sizeof(NSString *));
+    NSUInteger length = start.length + end.length + ((count > 1) ? (count - 1) * sep.length : 0);
+    NSUInteger i = 0;
+    for (id obj in array) {
+        strings[i] = FNXStringForElement(obj);
+        length += strings[i].length;
+        ++i;
+    }
+
+    NSString *result = @"";
+    if (length > 0) {
+        unichar *characters = (unichar *)malloc(length * sizeof(unichar));
+        NSUInteger position = 0;
+        [start getCharacters:characters range:NSMakeRange(0, start.length)];
+        position += start.length;
+        for (i = 0; i < count; ++i) {
+            if (i > 0) {
+                [sep getCharacters:characters + position range:NSMakeRange(0, sep.length)];
+                position += sep.length;
+            }
+            [strings[i] getCharacters:characters + position range:NSMakeRange(0, strings[i].length)];
+            position += strings[i].length;
+        }
+        [end getCharacters:characters + position range:NSMakeRange(0, end.length)];
+        result = [[NSString alloc] initWithCharactersNoCopy:characters length:length freeWhenDone:YES];
+    }
+
+    for (i = 0; i < count; ++i) {
+        strings[i] = nil;
+    }
+    free(strings);
+    return result;
+}
+
+// Appends the UTF-8 encoding of string to chunk, handing the chunk to write each time it fills up.
+static BOOL FNXAppendToChunk(NSString *string, uint8_t *chunk, NSUInteger *used, FNXByteWriter writer)
+{
+    NSRange remaining = NSMakeRange(0, string.length);
+    while (remaining.length > 0) {
+        NSUInteger usedLength = 0;
+        [string getBytes:chunk + *used
+               maxLength:FNXStringChunkSize - *used
+              usedLength:&usedLength
+                encoding:NSUTF8StringEncoding
+                 options:NSStringEncodingConversionAllowLossy
+                   range:remaining
+          remainingRange:&remaining];
+        *used += usedLength;
+        if (remaining.length > 0) {
+            if (0 == *used) {
+                // Nothing could be converted even into an empty chunk.
+                return NO;
+            }
+            if (!writer(chunk, *used)) {
+                return NO;
+            }
+            *used = 0;
+        }
+    }
+    return YES;
+}
+
+// Writes the elements of array joined into a single string as UTF-8, a chunk at a time, so the whole string is never
+// held in memory.
+static BOOL FNXWriteJoinedString(NSArray *array, NSString *start, NSString *sep, NSString *end, FNXByteWriter writer)
+{
+    uint8_t *chunk = (uint8_t *)malloc(FNXStringChunkSize);
+    NSUInteger used = 0;
+    BOOL success = FNXAppendToChunk(start ?: @"", chunk, &used, writer);
+    BOOL first = YES;
+    for (id obj in array) {
+        if (!success) {
+            break;
+        }
+        @autoreleasepool {
+            if (!first && nil != sep) {
+                success = FNXAppendToChunk(sep, chunk, &used, writer);
+            }
+            first = NO;
+            success = success && FNXAppendToChunk(FNXStringForElement(obj), chunk, &used, writer);
+        }
+    }
+    success = success && FNXAppendToChunk(end ?: @"", chunk, &used, writer);
+    success = success && (0 == used || writer(chunk, used));
+    free(chunk);
+    return success;
+}
+
+// Appends the objects that aren't in seen to result, in order, adding them to seen as it goes.
+static void FNXAppendUnseenObjects(NSArray *objects, NSMutableSet *seen, NSMutableArray *result)
+{
+    for (id obj in objects) {
+        NSUInteger seenCount = seen.count;
+        [seen addObject:obj];
+        if (seen.count > seenCount) {
+            [result addObject:obj];
+        }
+    }
+}
+
+// Runs of up to this many indexes are sorted by insertion before they're merged.
+static const NSUInteger FNXInsertionSortLength = 16;
+
+// Merges the sorted runs [lo, mid) and [mid, hi) of indexes, ordered by the keys they refer to, using the same range of
+// scratch to hold the left run. Of equal keys, those from the left run come first, which keeps the sort stable.
+static void FNXMergeIndexes(NSUInteger *indexes, NSUInteger *scratch, NSUInteger lo, NSUInteger mid, NSUInteger hi,
+                            __unsafe_unretained id *keys)
+{
+    if (mid == lo || mid == hi || NSOrderedDescending != [keys[indexes[mid - 1]] compare:keys[indexes[mid]]]) {
+        return;
+    }
+    memcpy(scratch + lo, indexes + lo, (mid - lo) * sizeof(NSUInteger));
+    NSUInteger left = lo;
+    NSUInteger right = mid;
+    NSUInteger out = lo;
+    while (left < mid && right < hi) {
+        if (NSOrderedAscending == [keys[indexes[right]] compare:keys[scratch[left]]]) {
+            indexes[out++] = indexes[right++];
+        } else {
+            indexes[out++] = scratch[left++];
+        }
+    }
+    // Whatever is left of the right run is already in place.
+    while (left < mid) {
+        indexes[out++] = scratch[left++];
+    }
+}
+
+// Stably sorts [lo, hi) of indexes by the keys they refer to, ordered by compare:.
+static void FNXSortIndexes(NSUInteger *indexes, NSUInteger *scratch, NSUInteger lo, NSUInteger hi,
+                           __unsafe_unretained id *keys)
+{
+    for (NSUInteger start = lo; start < hi; start += FNXInsertionSortLength) {
+        NSUInteger end = MIN(start + FNXInsertionSortLength, hi);
+        for (NSUInteger i = start + 1; i < end; ++i) {
+            NSUInteger index = indexes[i];
+            NSUInteger j = i;
+            while (j > start && NSOrderedDescending == [keys[indexes[j - 1]] compare:keys[index]]) {
+                indexes[j] = indexes[j - 1];
+                --j;
+            }
+            indexes[j] = index;
+        }
+    }
+    for (NSUInteger width = FNXInsertionSortLength; width < hi - lo; width *= 2) {
+        for (NSUInteger start = lo; start + width < hi; start += 2 * width) {
+            FNXMergeIndexes(indexes, scratch, start, start + width, MIN(start + 2 * width, hi), keys);
+        }
+    }
+}
+
+// Returns an array of the objects at indexes, in that order.
+static NSArray *FNXArrayOfObjectsAtIndexes(__unsafe_unretained id *objects, const NSUInteger *indexes, NSUInteger count)
+{
+    __unsafe_unretained id *result = (__unsafe_unretained id *)malloc(MAX(count, (NSUInteger)1) * sizeof(id));
+    for (NSUInteger i = 0; i < count; ++i) {
+        result[i] = objects[indexes[i]];
+    }
+    NSArray *array = [NSArray arrayWithObjects:result count:count];
+    free(result);
+    return array;
+}
+
+// Whether the element with key1 at index1 ranks below the one with key2 at index2 in fnx_topK:by:, that is, whether
+// it has a smaller key, or an equal key and a later index.
+static BOOL FNXRanksBelow(id key1, NSUInteger index1, id key2, NSUInteger index2)
+{
+    NSComparisonResult order = [key1 compare:key2];
+    return NSOrderedAscending == order || (NSOrderedSame == order && index1 > index2);
+}
+
+// Swaps entries a and b of a heap.
+static void FNXSwapHeapEntries(__strong id *keys, NSUInteger *indexes, NSUInteger a, NSUInteger b)
+{
+    id key = keys[a];
+    keys[a] = keys[b];
+    keys[b] = key;
+    NSUInteger index = indexes[a];
+    indexes[a] = indexes[b];
+    indexes[b] = index;
+}
+
+// Restores the heap order of a heap whose lowest ranked entry is at the root, after entry i was added at the end.
+static void FNXHeapSiftUp(__strong id *keys, NSUInteger *indexes, NSUInteger i)
+{
+    while (i > 0) {
+        NSUInteger parent = (i - 1) / 2;
+        if (!FNXRanksBelow(keys[i], indexes[i], keys[parent], indexes[parent])) {
+            return;
+        }
+        FNXSwapHeapEntries(keys, indexes, i, parent);
+        i = parent;
+    }
+}
+
+// Restores the heap order of a heap whose lowest ranked entry is at the root, after entry i was replaced.
+static void FNXHeapSiftDown(__strong id *keys, NSUInteger *indexes, NSUInteger size, NSUInteger i)
+{
+    for (;;) {
+        NSUInteger lowest = i;
+        NSUInteger left = 2 * i + 1;
+        NSUInteger right = left + 1;
+        if (left < size && FNXRanksBelow(keys[left], indexes[left], keys[lowest], indexes[lowest])) {
+            lowest = left;
+        }
+        if (right < size && FNXRanksBelow(keys[right], indexes[right], keys[lowest], indexes[lowest])) {
+            lowest = right;
+        }
+        if (lowest == i) {
+            return;
+        }
+        FNXSwapHeapEntries(keys, indexes, i, lowest);
+        i = lowest;
+    }
+}
+
+// Returns the first element of array with the smallest key computed by fn, or the largest if largest is YES.
+static id FNXExtremumBy(NSArray *array, id (^fn)(id obj), BOOL largest)
+{
+    NSComparisonResult better = largest ? NSOrderedDescending : NSOrderedAscending;
+    id result = nil;
+    id resultKey = nil;
+    for (id obj in array) {
+        id key = fn(obj);
+        if (nil == result || better == [key compare:resultKey]) {
+            result = obj;
+            resultKey = key;
+        }
+    }
+    return result;
+}
+
+// The implementation of a selector for the class it was last resolved for. The selector-based operators resolve it
+// again only when the class of the element changes, so homogeneous collections look the method up once.
+typedef struct {
+    SEL selector;
+    __unsafe_unretained Class cls;
+    IMP imp;
+} FNXIMPCache;
+
+static inline FNXIMPCache FNXIMPCacheMake(SEL selector)
+{
+    FNXIMPCache cache = { selector, Nil, NULL };
+    return cache;
+}
+
+// Returns the implementation of the cache's selector for obj.
+static inline IMP FNXIMPCacheLookup(FNXIMPCache *cache, id obj)
+{
+    Class cls = object_getClass(obj);
+    if (cls != cache->cls) {
+        cache->cls = cls;
+        cache->imp = [obj methodForSelector:cache->selector];
+    }
+    return cache->imp;
+}
+
+// Invokes body for consecutive ranges of at most batchSize of count elements, draining an autorelease pool after each.
+static void FNXForRangesInAutoreleasePools(NSUInteger count, NSUInteger batchSize, void (^body)(NSRange range))
+{
+    for (NSUInteger location = 0; location < count; location += batchSize) {
+        @autoreleasepool {
+            body(NSMakeRange(location, MIN(batchSize, count - location)));
+        }
+    }
+}
+
 @implementation NSArray (FNXFunctionalExtensions)
 
-// Builds a new array from this collection without any duplicate elements.
-- (NSArray *)fnx_distinct
+// Returns the elements of this collection that aren't in other.
+- (NSArray *)fnx_diff:(NSArray *)other
+{
+    // Seeding the table with other makes the excluded elements look like duplicates.
+    NSMutableSet *seen = [NSMutableSet setWithCapacity:self.count + other.count];
+    [seen addObjectsFromArray:other];
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
+    FNXAppendUnseenObjects(self, seen, result);
+    return [result copy];
+}
+
+// Builds a new array from this collection without any duplicate elements.
+- (NSArray *)fnx_distinct
+{
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
+    // [self valueForKeyPath:@"@distinctUnionOfObjects.self"] doesn't preserve order.
+    NSMutableSet *seen = [NSMutableSet setWithCapacity:self.count];
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
+    FNXAppendUnseenObjects(self, seen, result);
+    return [result copy];
+}
+
+// Builds a new array from this collection without any elements whose key, as computed by fn, is a duplicate.
+- (NSArray *)fnx_distinctBy:(id (^)(id obj))fn
+{
+    NSMutableSet *seen = [NSMutableSet setWithCapacity:self.count];
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
+    for (id obj in self) {
+        NSUInteger seenCount = seen.count;
+        [seen addObject:fn(obj)];
+        if (seen.count > seenCount) {
+            [result addObject:obj];
+        }
+    }
+    return [result copy];
+}
+
+// Selects all elements except last n ones.
+- (NSArray *)fnx_dropRight:(NSUInteger)n
+{
+    if (n >= self.count) {
+        return [NSArray array];
+    } else {
+        NSRange range = NSMakeRange(0, self.count - n);
+        return [FNXArraySlice sliceWithArray:self range:range];
+    }
+}
+
+// Drops longest prefix of elements that satisfy a predicate.
+- (NSArray *)fnx_dropWhile:(BOOL (^)(id obj))pred
+{
+    if (0 == self.count) {
+        return [NSArray array];
+    } else {
+        NSUInteger start = 0;
+        while (start < self.count && pred(self[start])) {
+            ++start;
+        }
+        NSRange range = NSMakeRange(start, self.count - start);
+        return [FNXArraySlice sliceWithArray:self range:range];
+    }
+}
+
+// Applies a function fn to all elements of this collection and their indexes.
+- (void)fnx_foreachWithIndex:(void (^)(id obj, NSUInteger idx))fn
+{
+    NSUInteger index = 0;
+    for (id obj in self) {
+        fn(obj, index++);
+    }
+}
+
+// Partitions this collection into consecutive groups of n elements, backed by this collection.
+- (NSArray *)fnx_grouped:(NSUInteger)n
+{
+    return [FNXWindowedArray arrayWithWindowsOfArray:self size:n step:n];
+}
+
+// Partitions this collection into a dictionary of collections according to some discriminator function, fn. The
+// discriminator function should return an object representing which bucket the object must be placed into and that will
+// be used as a key in the resultant dictionary.
+- (NSDictionary *)fnx_groupBy:(id (^)(id obj))fn
+{
+    NSUInteger batchSize = [FNXAutoreleaseBatching defaultBatchSize];
+    if (0 != batchSize) {
+        return [self fnx_groupBy:fn autoreleaseEvery:batchSize];
+    }
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
+    NSMutableDictionary *result = [NSMutableDictionary dictionary];
+    // Partition the objects in this collection into buckets whose key is determined by fn.
+    for (id obj in self) {
+        id key = fn(obj);
+        NSMutableArray *collectionForKey = result[key];
+        if (nil == collectionForKey) {
+            collectionForKey = [NSMutableArray array];
+            result[key] = collectionForKey;
+        }
+        [collectionForKey addObject:obj];
+    }
+    // Return an immutable result, with immutable buckets.
+    return FNXImmutableBuckets(result);
+}
+
+// Partitions this collection according to the discriminator function fn and reduces each bucket with op.
+- (NSDictionary *)fnx_groupBy:(id (^)(id obj))fn reduce:(id (^)(id accumulator, id obj))op
+{
+    NSParameterAssert(nil != fn);
+    NSParameterAssert(nil != op);
+    NSMutableDictionary *result = [NSMutableDictionary dictionary];
+    for (id obj in self) {
+        id key = fn(obj);
+        id accumulator = result[key];
+        result[key] = (nil == accumulator) ? obj : op(accumulator, obj);
+    }
+    return [result copy];
+}
+
+// Selects all elements of this collection for which pred returns YES.
+- (NSArray *)fnx_filterWithSelector:(SEL)pred
+{
+    NSParameterAssert(nil != pred);
+    FNXIMPCache cache = FNXIMPCacheMake(pred);
+    NSMutableArray *result = [NSMutableArray array];
+    for (id obj in self) {
+        BOOL (*resolvedPred)(id, SEL) = (void *)FNXIMPCacheLookup(&cache, obj);
+        if (resolvedPred(obj, pred)) {
+            [result addObject:obj];
+        }
+    }
+    return [result copy];
+}
+
+// Finds the first element of the collection satisfying a predicate, or nil if there is none.
+- (id)fnx_findValue:(BOOL (^)(id obj))pred
+{
+    for (id obj in self) {
+        if (pred(obj)) {
+            return obj;
+        }
+    }
+    return nil;
+}
+
+// Builds a new collection by applying a function to all elements of this collection
+// and using the elements of the resulting collections.
+- (NSArray *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn
+{
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
+    NSMutableArray *result = [NSMutableArray array];
+    for (id obj in self) {
+        [result addObjectsFromArray:fn(obj).fnx_toArray];
+    }
+    return [result copy];
+}
+
+// Applies a binary operator to a start value and the elements of this collection, going left to right, until op sets
+// *stop to YES.
+- (id)fnx_foldLeftWhileWithStartValue:(id)startValue
+                                   op:(id (^)(id accumulator, id obj, NSUInteger idx, BOOL *stop))op
+{
+    NSParameterAssert(nil != op);
+    id accumulator = startValue;
+    NSUInteger index = 0;
+    BOOL stop = NO;
+    for (id obj in self) {
+        accumulator = op(accumulator, obj, index++, &stop);
+        if (stop) {
+            break;
+        }
+    }
+    return accumulator;
+}
+
+// Invokes pred for elements of this collection. Returns NO if any results return NO; YES, otherwise.
+- (BOOL)fnx_forallWithSelector:(SEL)pred
+{
+    NSParameterAssert(nil != pred);
+    FNXIMPCache cache = FNXIMPCacheMake(pred);
+    for (id obj in self) {
+        BOOL (*resolvedPred)(id, SEL) = (void *)FNXIMPCacheLookup(&cache, obj);
+        BOOL result = resolvedPred(obj, pred);
+        if (!result) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+// Invokes fn for elements of this collection.
+// fn must be a method on the element that takes no arguments and returns void.
+- (void)fnx_foreachWithSelector:(SEL)fn
+{
+    NSParameterAssert(nil != fn);
+    FNXIMPCache cache = FNXIMPCacheMake(fn);
+    for (id obj in self) {
+        void (*resolvedFn)(id, SEL) = (void *)FNXIMPCacheLookup(&cache, obj);
+        resolvedFn(obj, fn);
+    }
+}
+
+// Returns the elements of this collection that are also in other.
+- (NSArray *)fnx_intersect:(NSArray *)other
+{
+    // Each match is removed from the table, which keeps duplicates out of the result, and once the table is empty
+    // no later element can match.
+    NSMutableSet *remaining = [NSMutableSet setWithArray:other];
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:MIN(self.count, remaining.count)];
+    for (id obj in self) {
+        NSUInteger remainingCount = remaining.count;
+        if (0 == remainingCount) {
+            break;
+        }
+        [remaining removeObject:obj];
+        if (remaining.count < remainingCount) {
+            [result addObject:obj];
+        }
+    }
+    return [result copy];
+}
+
+// Builds a new collection by applying a function to all elements of this collection, once per distinct element.
+- (NSArray *)fnx_mapMemoized:(id (^)(id obj))fn
+{
+    // The memo only lives for this call, so it can hold every distinct element without a bound.
+    FNXMemo *memo = [FNXMemo memoWithBlock:fn capacity:0];
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
+    for (id obj in self) {
+        [result addObject:[memo valueForObject:obj]];
+    }
+    return [result copy];
+}
+
+// Builds a new collection by applying a function to all elements of this collection.
+// If fn could return nil, it must return [FNXNone none] instead and the other values
+// should be mapped as FNXSome values.
+// The FNXTuple2 object returned from fn should have _1 as the key and _2 as the value.
+- (NSDictionary *)fnx_mapToDictionary:(FNXTuple2 *(^)(id obj))fn
+{
+    NSMutableDictionary *result = [NSMutableDictionary dictionaryWithCapacity:self.count];
+    for (id obj in self) {
+        FNXTuple2 *tuple2 = fn(obj);
+        result[tuple2._1] = tuple2._2;
+    }
+    return [result copy];
+}
+
+// Builds a new collection from the results of invoking fn on all elements of this collection.
+- (NSArray *)fnx_mapWithSelector:(SEL)fn
+{
+    NSParameterAssert(nil != fn);
+    FNXIMPCache cache = FNXIMPCacheMake(fn);
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
+    for (id obj in self) {
+        id (*resolvedFn)(id, SEL) = (void *)FNXIMPCacheLookup(&cache, obj);
+        [result addObject:resolvedFn(obj, fn)];
+    }
+    return [result copy];
+}
+
+// Finds the first element which yields the largest key, as computed by fn and ordered by compare:.
+- (id)fnx_maxBy:(id (^)(id obj))fn
+{
+    NSParameterAssert(nil != fn);
+    if (self.fnx_isEmpty) {
+        @throw [[NSException alloc] initWithName:@"FNXUnsupportedOperation"
+                                          reason:NSLocalizedString(@"empty.maxBy", @"Message when [NSArray fnx_maxBy:] is called")
+                                        userInfo:nil];
+    }
+    return FNXExtremumBy(self, fn, YES);
+}
+
+// Finds the first element which yields the smallest key, as computed by fn and ordered by compare:.
+- (id)fnx_minBy:(id (^)(id obj))fn
+{
+    NSParameterAssert(nil != fn);
+    if (self.fnx_isEmpty) {
+        @throw [[NSException alloc] initWithName:@"FNXUnsupportedOperation"
+                                          reason:NSLocalizedString(@"empty.minBy", @"Message when [NSArray fnx_minBy:] is called")
+                                        userInfo:nil];
+    }
+    return FNXExtremumBy(self, fn, NO);
+}
+
+// Displays all elements of this list in a string.
+- (NSString *)fnx_mkString
+{
+    return FNXJoinedString(self, nil, nil, nil);
+}
+
+// Displays all elements of this list in a string using a separator string.
+- (NSString *)fnx_mkString:(NSString *)sep
+{
+    return FNXJoinedString(self, nil, sep, nil);
+}
+
+// Displays all elements of this list in a string using start, end, and separator strings.
+- (NSString *)fnx_mkStringWithStart:(NSString *)start sep:(NSString *)sep end:(NSString *)end
+{
+    return FNXJoinedString(self, start, sep, end);
+}
+
+// Writes all elements of this list to a file descriptor as a UTF-8 string using start, end, and separator strings.
+- (BOOL)fnx_mkStringToFileDescriptor:(int)fileDescriptor
+                               start:(NSString *)start
+                                 sep:(NSString *)sep
+                                 end:(NSString *)end
+                               error:(NSError **)error
+{
+    __block int errorCode = 0;
+    BOOL success = FNXWriteJoinedString(self, start, sep, end, ^BOOL(const uint8_t *bytes, NSUInteger length) {
+        while (length > 0) {
+            ssize_t written = write(fileDescriptor, bytes, length);
+            if (written < 0) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                errorCode = errno;
+                return NO;
+            }
+            bytes += written;
+            length -= (NSUInteger)written;
+        }
+        return YES;
+    });
+    if (!success && error) {
+        *error = (0 != errorCode)
+            ? [NSError errorWithDomain:NSPOSIXErrorDomain code:errorCode userInfo:nil]
+            : [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteInapplicableStringEncodingError userInfo:nil];
+    }
+    return success;
+}
+
+// Writes all elements of this list to an output stream as a UTF-8 string using start, end, and separator strings.
+- (BOOL)fnx_mkStringToStream:(NSOutputStream *)stream
+                       start:(NSString *)start
+                         sep:(NSString *)sep
+                         end:(NSString *)end
+                       error:(NSError **)error
+{
+    __block NSError *streamError = nil;
+    BOOL success = FNXWriteJoinedString(self, start, sep, end, ^BOOL(const uint8_t *bytes, NSUInteger length) {
+        while (length > 0) {
+            NSInteger written = [stream write:bytes maxLength:length];
+            if (written <= 0) {
+                streamError = stream.streamError
+                    ?: [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteOutOfSpaceError userInfo:nil];
+                return NO;
+            }
+            bytes += written;
+            length -= (NSUInteger)written;
+        }
+        return YES;
+    });
+    if (!success && error) {
+        *error = streamError
+            ?: [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteInapplicableStringEncodingError userInfo:nil];
+    }
+    return success;
+}
+
+// Returns a new collection with the elements of this collection in reversed order.
+- (NSArray *)fnx_reverse
+{
+    return (0 == self.count) ? [NSArray array] : self.reverseObjectEnumerator.allObjects;
+}
+
+// Produces the running accumulations of op over this collection, going left to right, starting with the start value.
+- (NSArray *)fnx_scanLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op
+{
+    NSParameterAssert(nil != op);
+    NSUInteger count = self.count;
+    __strong id *accumulations = (__strong id *)calloc(count + 1, sizeof(id));
+    accumulations[0] = startValue;
+    NSUInteger index = 0;
+    for (id obj in self) {
+        accumulations[index + 1] = op(accumulations[index], obj);
+        ++index;
+    }
+    NSArray *result = [NSArray arrayWithObjects:accumulations count:count + 1];
+    for (NSUInteger i = 0; i <= count; ++i) {
+        accumulations[i] = nil;
+    }
+    free(accumulations);
+    return result;
+}
+
+// Selects the elements in range. The range is clipped to the bounds of this collection.
+- (NSArray *)fnx_slice:(NSRange)range
+{
+    NSUInteger count = self.count;
+    NSUInteger start = MIN(range.location, count);
+    NSUInteger length = MIN(range.length, count - start);
+    return [FNXArraySlice sliceWithArray:self range:NSMakeRange(start, length)];
+}
+
+// Returns the windows of size consecutive elements of this collection, starting every step elements, backed by this
+// collection.
+- (NSArray *)fnx_sliding:(NSUInteger)size step:(NSUInteger)step
+{
+    return [FNXWindowedArray arrayWithWindowsOfArray:self size:size step:step];
+}
+
+// Sorts this collection by the keys computed by fn, ordered by compare:. The sort is stable.
+- (NSArray *)fnx_sortBy:(id (^)(id obj))fn
+{
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
+    NSParameterAssert(nil != fn);
+    NSUInteger count = self.count;
+    if (count < 2) {
+        return [self copy];
+    }
+    // Compute every key once up front, then sort an array of indexes by them. keys doesn't retain what it points at, so
+    // keyArray has to outlive the sort rather than be released after its last use.
+    __attribute__((objc_precise_lifetime)) NSArray *keyArray = [self fnx_map:fn];
+    __unsafe_unretained id *keys = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [keyArray getObjects:keys range:NSMakeRange(0, count)];
+    NSUInteger *indexes = (NSUInteger *)malloc(count * sizeof(NSUInteger));
+    NSUInteger *scratch = (NSUInteger *)malloc(count * sizeof(NSUInteger));
+    for (NSUInteger i = 0; i < count; ++i) {
+        indexes[i] = i;
+    }
+    FNXSortIndexes(indexes, scratch, 0, count, keys);
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    NSArray *result = FNXArrayOfObjectsAtIndexes(objects, indexes, count);
+    free(objects);
+    free(scratch);
+    free(indexes);
+    free(keys);
+    return result;
+}
+
+// Sorts this collection with comparator, a method on the elements that takes another element. The sort is stable.
+- (NSArray *)fnx_sortWithSelector:(SEL)comparator
+{
+    NSParameterAssert(nil != comparator);
+    __block FNXIMPCache cache = FNXIMPCacheMake(comparator);
+    return [self sortedArrayWithOptions:NSSortStable usingComparator:^NSComparisonResult(id obj1, id obj2) {
+        NSComparisonResult (*resolvedComparator)(id, SEL, id) = (void *)FNXIMPCacheLookup(&cache, obj1);
+        return resolvedComparator(obj1, comparator, obj2);
+    }];
+}
+
+// Splits this collection into two at a given position.
+- (FNXTuple2 *)fnx_splitAt:(NSUInteger)n
+{
+    return [FNXTuple2 tuple2With_1:[self fnx_take:n] _2:[self fnx_drop:n]];
+}
+
+// Selects the first n elements.
+- (NSArray *)fnx_take:(NSUInteger)n
+{
+    return [self fnx_slice:NSMakeRange(0, n)];
+}
+
+// Selects the last n elements.
+- (NSArray *)fnx_takeRight:(NSUInteger)n
+{
+    NSUInteger count = self.count;
+    return (n >= count) ? [self fnx_slice:NSMakeRange(0, count)] : [self fnx_slice:NSMakeRange(count - n, n)];
+}
+
+// Returns a dictionary assuming that this collection contains elements that are FNXTuple2 objects, where _1 is the
+// key and _2 is the value.
+- (NSDictionary *)fnx_toDictionary
+{
+    NSMutableDictionary *result = [NSMutableDictionary dictionary];
+    for (FNXTuple2 *tuple2 in self) {
+        result[tuple2._1] = tuple2._2;
+    }
+    return [result copy];
+}
+
+// Selects the k elements which yield the largest keys, as computed by fn and ordered by compare:, from the largest key
+// down.
+- (NSArray *)fnx_topK:(NSUInteger)k by:(id (^)(id obj))fn
+{
+    NSParameterAssert(nil != fn);
+    k = MIN(k, self.count);
+    if (0 == k) {
+        return [NSArray array];
+    }
+    // A heap of the best k elements seen so far, with the lowest ranked of them at the root.
+    __strong id *keys = (__strong id *)calloc(k, sizeof(id));
+    NSUInteger *indexes = (NSUInteger *)malloc(k * sizeof(NSUInteger));
+    NSUInteger size = 0;
+    NSUInteger index = 0;
+    for (id obj in self) {
+        id key = fn(obj);
+        if (size < k) {
+            keys[size] = key;
+            indexes[size] = index;
+            FNXHeapSiftUp(keys, indexes, size++);
+        } else if (FNXRanksBelow(keys[0], indexes[0], key, index)) {
+            keys[0] = key;
+            indexes[0] = index;
+            FNXHeapSiftDown(keys, indexes, size, 0);
+        }
+        ++index;
+    }
+    // Popping the heap yields the elements from the lowest ranked up, so fill the result from the back.
+    __unsafe_unretained id *result = (__unsafe_unretained id *)malloc(k * sizeof(id));
+    while (size > 0) {
+        result[size - 1] = self[indexes[0]];
+        FNXSwapHeapEntries(keys, indexes, 0, size - 1);
+        keys[--size] = nil;
+        FNXHeapSiftDown(keys, indexes, size, 0);
+    }
+    NSArray *array = [NSArray arrayWithObjects:result count:k];
+    free(result);
+    free(indexes);
+    free(keys);
+    return array;
+}
+
+// Returns the elements of this collection followed by the elements of other, without duplicates.
+- (NSArray *)fnx_union:(NSArray *)other
 {
-    // [self valueForKeyPath:@"@distinctUnionOfObjects.self"] doesn't preserve order.
-    return [NSOrderedSet orderedSetWithArray:self].array;
+    NSMutableSet *seen = [NSMutableSet setWithCapacity:self.count + other.count];
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count + other.count];
+    FNXAppendUnseenObjects(self, seen, result);
+    FNXAppendUnseenObjects(other, seen, result);
+    return [result copy];
 }
 
-// Selects all elements except last n ones.
-- (NSArray *)fnx_dropRight:(NSUInteger)n
+// Converts this collection of FNXTuple2 pairs into a pair of arrays of their first and second components.
+- (FNXTuple2 *)fnx_unzip
 {
-    if (n >= self.count) {
-        return [NSArray array];
-    } else {
-        NSRange range = NSMakeRange(0, self.count - n);
-        NSIndexSet *indexSet = [NSIndexSet indexSetWithIndexesInRange:range];
-        return [self objectsAtIndexes:indexSet];
+    if ([self isKindOfClass:[FNXZippedArray class]]) {
+        // The components are already stored separately.
+        FNXZippedArray *zipped = (FNXZippedArray *)self;
+        return [FNXTuple2 tuple2With_1:zipped.firsts _2:zipped.seconds];
+    }
+    NSMutableArray *firsts = [NSMutableArray arrayWithCapacity:self.count];
+    NSMutableArray *seconds = [NSMutableArray arrayWithCapacity:self.count];
+    for (FNXTuple2 *tuple2 in self) {
+        [firsts addObject:tuple2._1];
+        [seconds addObject:tuple2._2];
     }
+    return [FNXTuple2 tuple2With_1:[firsts copy] _2:[seconds copy]];
 }
 
-// Drops longest prefix of elements that satisfy a predicate.
-- (NSArray *)fnx_dropWhile:(BOOL (^)(id obj))pred
+// Returns a lazy view of this collection, whose transformers are fused into a single pass.
+- (FNXView *)fnx_view
 {
-    if (0 == self.count) {
-        return [NSArray array];
-    } else {
-        NSUInteger start = 0;
-        while (start < self.count && pred(self[start])) {
-            ++start;
+    return [FNXView viewWithCollection:self];
+}
+
+// Returns an array of FNXTuple2 pairs of corresponding elements of this collection and other.
+- (NSArray *)fnx_zip:(NSArray *)other
+{
+    return [FNXZippedArray arrayByZipping:self with:other];
+}
+
+// Builds a new collection by applying a function to corresponding elements of this collection and other.
+- (NSArray *)fnx_zip:(NSArray *)other with:(id (^)(id obj1, id obj2))fn
+{
+    NSUInteger count = MIN(self.count, other.count);
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:count];
+    NSUInteger index = 0;
+    for (id obj in self) {
+        if (index == count) {
+            break;
         }
-        NSRange range = NSMakeRange(start, self.count - start);
-        NSIndexSet *indexSet = [NSIndexSet indexSetWithIndexesInRange:range];
-        return [self objectsAtIndexes:indexSet];
+        [result addObject:fn(obj, other[index])];
+        ++index;
     }
+    return [result copy];
 }
 
-// Partitions this collection into a dictionary of collections according to some discriminator function, fn. The
-// discriminator function should return an object representing which bucket the object must be placed into and that will
-// be used as a key in the resultant dictionary.
-- (NSDictionary *)fnx_groupBy:(id (^)(id obj))fn
+// Returns an array of FNXTuple2 pairs of each element of this collection and its index.
+- (NSArray *)fnx_zipWithIndex
 {
-    NSMutableDictionary *result = [NSMutableDictionary dictionary];
-    // Partition the objects in this collection into buckets whose key is determined by fn.
-    for (id obj in self) {
-        id key = fn(obj);
-        NSMutableArray *collectionForKey = result[key];
-        if (nil == collectionForKey) {
-            collectionForKey = [NSMutableArray array];
-            result[key] = collectionForKey;
+    return [FNXZippedArray arrayByZippingWithIndex:self];
+}
+
+@end
+
+
+@implementation NSArray (FNXParallel)
+
+// Counts the number of elements in the collection which satisfy a predicate, in _parallel_.
+- (NSUInteger)fnx_countParallel:(BOOL (^)(id obj))pred
+{
+    NSParameterAssert(nil != pred);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    // Each chunk counts into its own slot, so no synchronization is needed.
+    NSUInteger grainSize = [FNXParallel grainSizeForCount:count requestedGrainSize:0];
+    NSUInteger chunkCount = [FNXParallel chunkCountForCount:count grainSize:grainSize];
+    NSUInteger *partials = (NSUInteger *)calloc(MAX(chunkCount, (NSUInteger)1), sizeof(NSUInteger));
+    [FNXParallel forChunksOfCount:count grainSize:grainSize block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        NSUInteger partial = 0;
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            if (pred(objects[i])) {
+                partial += 1;
+            }
         }
-        [collectionForKey addObject:obj];
+        partials[chunk] = partial;
+    }];
+    NSUInteger result = 0;
+    for (NSUInteger chunk = 0; chunk < chunkCount; ++chunk) {
+        result += partials[chunk];
     }
-    // Change the mutable arrays in the result to immutable arrays.
-    NSArray *keys = result.allKeys;
+    free(partials);
+    free(objects);
+    return result;
+}
+
+// Returns the elements of this collection that aren't in other, testing membership in _parallel_.
+- (NSArray *)fnx_diffParallel:(NSArray *)other
+{
+    NSSet *excluded = [NSSet setWithArray:other];
+    // Only the survivors of the parallel filter need to be deduplicated.
+    return [[self fnx_filterParallel:^BOOL(id obj) {
+        return ![excluded containsObject:obj];
+    }] fnx_distinct];
+}
+
+// Builds a new array from this collection without any elements whose key is a duplicate, computing the keys in
+// _parallel_.
+- (NSArray *)fnx_distinctByParallel:(id (^)(id obj))fn
+{
+    NSArray *keys = [self fnx_mapParallel:fn];
+    NSMutableSet *seen = [NSMutableSet setWithCapacity:self.count];
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
+    NSUInteger index = 0;
     for (id key in keys) {
-        result[key] = [result[key] copy];
+        NSUInteger seenCount = seen.count;
+        [seen addObject:key];
+        if (seen.count > seenCount) {
+            [result addObject:self[index]];
+        }
+        ++index;
     }
-    // Return an immutable result.
     return [result copy];
 }
 
-// Builds a new collection by applying a function to all elements of this collection
-// and using the elements of the resulting collections.
-- (NSArray *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn
+// Tests whether a predicate holds for some of the elements of this collection, in _parallel_.
+- (BOOL)fnx_existsParallel:(BOOL (^)(id obj))pred
 {
-    NSMutableArray *result = [NSMutableArray array];
-    for (id obj in self) {
-        [result addObjectsFromArray:fn(obj).fnx_toArray];
+    NSParameterAssert(nil != pred);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    __block volatile BOOL result = NO;
+    [FNXParallel forChunksOfCount:count grainSize:0 block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range) && !*stop; ++i) {
+            if (pred(objects[i])) {
+                result = YES;
+                *stop = YES;
+            }
+        }
+    }];
+    free(objects);
+    return result;
+}
+
+// Selects all elements of this collection which satisfy a predicate, in _parallel_. Preserves the order of the elements.
+- (NSArray *)fnx_filterParallel:(BOOL (^)(id obj))pred
+{
+    return [self fnx_filterParallel:pred grainSize:0];
+}
+
+// Selects all elements of this collection which satisfy a predicate, in _parallel_, grainSize elements per task.
+- (NSArray *)fnx_filterParallel:(BOOL (^)(id obj))pred grainSize:(NSUInteger)grainSize
+{
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
+    NSParameterAssert(nil != pred);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    BOOL *selected = (BOOL *)malloc(count * sizeof(BOOL));
+    [FNXParallel forChunksOfCount:count grainSize:grainSize block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            selected[i] = pred(objects[i]);
+        }
+    }];
+    // Compact the selected elements in place, preserving their order.
+    NSUInteger selectedCount = 0;
+    for (NSUInteger i = 0; i < count; ++i) {
+        if (selected[i]) {
+            objects[selectedCount++] = objects[i];
+        }
     }
-    return [result copy];
+    NSArray *result = [NSArray arrayWithObjects:objects count:selectedCount];
+    free(selected);
+    free(objects);
+    return result;
 }
 
-// Invokes pred for elements of this collection. Returns NO if any results return NO; YES, otherwise.
-- (BOOL)fnx_forallWithSelector:(SEL)pred
+// Tests whether a predicate holds for all elements of this collection, in _parallel_.
+- (BOOL)fnx_forallParallel:(BOOL (^)(id obj))pred
 {
     NSParameterAssert(nil != pred);
-    for (id obj in self) {
-        IMP imp = [obj methodForSelector:pred];
-        BOOL (*resolvedPred)(id, SEL) = (void *)imp;
-        BOOL result = resolvedPred(obj, pred);
-        if (!result) {
-            return NO;
+    return ![self fnx_existsParallel:^BOOL(id obj) {
+        return !pred(obj);
+    }];
+}
+
+// Applies a function fn to all elements of this collection in _parallel_.
+- (void)fnx_foreachParallel:(void (^)(id obj))fn
+{
+    [self fnx_foreachParallel:fn grainSize:0];
+}
+
+// Applies a function fn to all elements of this collection in _parallel_, grainSize elements per task.
+- (void)fnx_foreachParallel:(void (^)(id obj))fn grainSize:(NSUInteger)grainSize
+{
+    NSParameterAssert(nil != fn);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    [FNXParallel forChunksOfCount:count grainSize:grainSize block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            fn(objects[i]);
+        }
+    }];
+    free(objects);
+}
+
+// Partitions this collection into a dictionary of collections according to some discriminator function, fn, in
+// _parallel_.
+- (NSDictionary *)fnx_groupByParallel:(id (^)(id obj))fn
+{
+    NSParameterAssert(nil != fn);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    NSUInteger grainSize = [FNXParallel grainSizeForCount:count requestedGrainSize:0];
+    NSUInteger chunkCount = [FNXParallel chunkCountForCount:count grainSize:grainSize];
+    __strong id *partials = (__strong id *)calloc(MAX(chunkCount, (NSUInteger)1), sizeof(id));
+    [FNXParallel forChunksOfCount:count grainSize:grainSize block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        NSMutableDictionary *buckets = [NSMutableDictionary dictionary];
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            id key = fn(objects[i]);
+            NSMutableArray *bucket = buckets[key];
+            if (nil == bucket) {
+                bucket = [NSMutableArray array];
+                buckets[key] = bucket;
+            }
+            [bucket addObject:objects[i]];
         }
+        partials[chunk] = buckets;
+    }];
+    // Merge the partial buckets in chunk order so each bucket keeps the original order of its elements.
+    NSMutableDictionary *result = (chunkCount > 0) ? partials[0] : [NSMutableDictionary dictionary];
+    for (NSUInteger chunk = 1; chunk < chunkCount; ++chunk) {
+        [partials[chunk] enumerateKeysAndObjectsUsingBlock:^(id key, NSMutableArray *bucket, BOOL *stop) {
+            NSMutableArray *merged = result[key];
+            if (nil == merged) {
+                result[key] = bucket;
+            } else {
+                [merged addObjectsFromArray:bucket];
+            }
+        }];
     }
-    return YES;
+    for (NSUInteger chunk = 0; chunk < chunkCount; ++chunk) {
+        partials[chunk] = nil;
+    }
+    free(partials);
+    free(objects);
+    return FNXImmutableBuckets(result);
 }
 
-// Invokes fn for elements of this collection.
-// fn must be a method on the element that takes no arguments and returns void.
-- (void)fnx_foreachWithSelector:(SEL)fn
+// Partitions this collection according to the discriminator function fn and reduces each bucket with op, in
+// _parallel_.
+- (NSDictionary *)fnx_groupByParallel:(id (^)(id obj))fn reduce:(id (^)(id accumulator, id obj))op
 {
     NSParameterAssert(nil != fn);
-    for (id obj in self) {
-        IMP imp = [obj methodForSelector:fn];
-        void (*resolvedFn)(id, SEL) = (void *)imp;
-        resolvedFn(obj, fn);
+    NSParameterAssert(nil != op);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    NSUInteger grainSize = [FNXParallel grainSizeForCount:count requestedGrainSize:0];
+    NSUInteger chunkCount = [FNXParallel chunkCountForCount:count grainSize:grainSize];
+    __strong id *partials = (__strong id *)calloc(MAX(chunkCount, (NSUInteger)1), sizeof(id));
+    [FNXParallel forChunksOfCount:count grainSize:grainSize block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        NSMutableDictionary *accumulators = [NSMutableDictionary dictionary];
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            id key = fn(objects[i]);
+            id accumulator = accumulators[key];
+            accumulators[key] = (nil == accumulator) ? objects[i] : op(accumulator, objects[i]);
+        }
+        partials[chunk] = accumulators;
+    }];
+    NSMutableDictionary *result = (chunkCount > 0) ? partials[0] : [NSMutableDictionary dictionary];
+    for (NSUInteger chunk = 1; chunk < chunkCount; ++chunk) {
+        [partials[chunk] enumerateKeysAndObjectsUsingBlock:^(id key, id partial, BOOL *stop) {
+            id accumulator = result[key];
+            result[key] = (nil == accumulator) ? partial : op(accumulator, partial);
+        }];
+    }
+    for (NSUInteger chunk = 0; chunk < chunkCount; ++chunk) {
+        partials[chunk] = nil;
     }
+    free(partials);
+    free(objects);
+    return [result copy];
 }
 
-// Applies a function fn to all elements of this collection in _parallel_.
-- (void)fnx_foreachParallel:(void (^)(id obj))fn
+// Returns the elements of this collection that are also in other, testing membership in _parallel_.
+- (NSArray *)fnx_intersectParallel:(NSArray *)other
+{
+    NSSet *members = [NSSet setWithArray:other];
+    // Only the survivors of the parallel filter need to be deduplicated.
+    return [[self fnx_filterParallel:^BOOL(id obj) {
+        return [members containsObject:obj];
+    }] fnx_distinct];
+}
+
+// Partitions this collection into groups of n elements and applies fn to every group in _parallel_.
+- (NSArray *)fnx_mapGroupedParallel:(NSUInteger)n fn:(id (^)(NSArray *group))fn
 {
     NSParameterAssert(nil != fn);
-    [self enumerateObjectsWithOptions:NSEnumerationConcurrent
-                           usingBlock:^(id obj, NSUInteger idx, BOOL *stop) {
-                               fn(obj);
-                           }];
+    return [[self fnx_grouped:n] fnx_mapParallel:fn grainSize:1];
 }
 
 // Builds a new collection by applying a function to all elements of this array in _parallel_.
@@ -137,81 +1322,323 @@
 // should be mapped as FNXSome values.
 - (NSArray *)fnx_mapParallel:(id (^)(id obj))fn
 {
-    NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
-    for (NSUInteger i = 0; i < self.count; ++i) {
-        [result addObject:NSNull.null];
-    }
-    
-    // Because the block may be called concurrently, we have to insert the result of the map directly,
-    // rather than using [addObject:].
-    [self enumerateObjectsWithOptions:NSEnumerationConcurrent
-                           usingBlock:^(id obj, NSUInteger idx, BOOL *stop) {
-                               result[idx] = fn(obj);
-                           }];
-    
-    return [result copy];
+    return [self fnx_mapParallel:fn grainSize:0];
 }
 
-// Builds a new collection by applying a function to all elements of this collection.
-// If fn could return nil, it must return [FNXNone none] instead and the other values
-// should be mapped as FNXSome values.
-// The FNXTuple2 object returned from fn should have _1 as the key and _2 as the value.
-- (NSDictionary *)fnx_mapToDictionary:(FNXTuple2 *(^)(id obj))fn
+// Builds a new collection by applying a function to all elements of this array in _parallel_, grainSize elements per
+// task.
+- (NSArray *)fnx_mapParallel:(id (^)(id obj))fn grainSize:(NSUInteger)grainSize
 {
-    NSMutableDictionary *result = [NSMutableDictionary dictionaryWithCapacity:self.count];
-    for (id obj in self) {
-        FNXTuple2 *tuple2 = fn(obj);
-        result[tuple2._1] = tuple2._2;
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
+    NSParameterAssert(nil != fn);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    // Each chunk writes to its own slots of a preallocated buffer, and the array is built once at the end.
+    __strong id *mapped = (__strong id *)calloc(MAX(count, (NSUInteger)1), sizeof(id));
+    [FNXParallel forChunksOfCount:count grainSize:grainSize block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            mapped[i] = fn(objects[i]);
+        }
+    }];
+    NSArray *result = [NSArray arrayWithObjects:mapped count:count];
+    for (NSUInteger i = 0; i < count; ++i) {
+        mapped[i] = nil;
     }
-    return [result copy];
+    free(mapped);
+    free(objects);
+    return result;
 }
 
-// Displays all elements of this list in a string.
-- (NSString *)fnx_mkString
+// Builds a dictionary by applying a function to all elements of this collection, in _parallel_.
+- (NSDictionary *)fnx_mapToDictionaryParallel:(FNXTuple2 *(^)(id obj))fn
 {
-    NSMutableString *result = [NSMutableString string];
-    for (id obj in self) {
-        [result appendFormat:@"%@", obj];
+    NSParameterAssert(nil != fn);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    NSUInteger grainSize = [FNXParallel grainSizeForCount:count requestedGrainSize:0];
+    NSUInteger chunkCount = [FNXParallel chunkCountForCount:count grainSize:grainSize];
+    __strong id *partials = (__strong id *)calloc(MAX(chunkCount, (NSUInteger)1), sizeof(id));
+    [FNXParallel forChunksOfCount:count grainSize:grainSize block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        NSMutableDictionary *entries = [NSMutableDictionary dictionaryWithCapacity:range.length];
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            FNXTuple2 *tuple2 = fn(objects[i]);
+            entries[tuple2._1] = tuple2._2;
+        }
+        partials[chunk] = entries;
+    }];
+    // Merging in chunk order lets later elements win, as they do in fnx_mapToDictionary:.
+    NSMutableDictionary *result = [NSMutableDictionary dictionaryWithCapacity:count];
+    for (NSUInteger chunk = 0; chunk < chunkCount; ++chunk) {
+        [result addEntriesFromDictionary:partials[chunk]];
+        partials[chunk] = nil;
     }
+    free(partials);
+    free(objects);
     return [result copy];
 }
 
-// Displays all elements of this list in a string using a separator string.
-- (NSString *)fnx_mkString:(NSString *)sep
+// Reduces the elements of this collection using an associative binary operator, in _parallel_.
+- (id)fnx_reduceParallel:(id (^)(id accumulator, id obj))op
 {
-    NSMutableString *result = [NSMutableString string];
-    BOOL prependSep = NO;
-    for (id obj in self) {
-        if (prependSep) {
-            [result appendFormat:@"%@%@", sep, obj];
-        } else {
-            [result appendFormat:@"%@", obj];
-            prependSep = YES;
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
+    NSParameterAssert(nil != op);
+    if (self.fnx_isEmpty) {
+        @throw [[NSException alloc] initWithName:@"FNXUnsupportedOperation"
+                                          reason:NSLocalizedString(@"empty.reduce", @"Message when [NSArray fnx_reduceParallel] is called")
+                                        userInfo:nil];
+    }
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    NSUInteger grainSize = [FNXParallel grainSizeForCount:count requestedGrainSize:0];
+    NSUInteger chunkCount = [FNXParallel chunkCountForCount:count grainSize:grainSize];
+    __strong id *partials = (__strong id *)calloc(chunkCount, sizeof(id));
+    [FNXParallel forChunksOfCount:count grainSize:grainSize block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        id accumulator = objects[range.location];
+        for (NSUInteger i = range.location + 1; i < NSMaxRange(range); ++i) {
+            accumulator = op(accumulator, objects[i]);
         }
+        partials[chunk] = accumulator;
+    }];
+    // Combine the partial results in their original order.
+    id result = partials[0];
+    for (NSUInteger chunk = 1; chunk < chunkCount; ++chunk) {
+        result = op(result, partials[chunk]);
     }
-    return [result copy];
+    for (NSUInteger chunk = 0; chunk < chunkCount; ++chunk) {
+        partials[chunk] = nil;
+    }
+    free(partials);
+    free(objects);
+    return result;
 }
 
-// Returns a new collection with the elements of this collection in reversed order.
-- (NSArray *)fnx_reverse
+// Sorts this collection by the keys computed by fn, like fnx_sortBy:, in _parallel_.
+- (NSArray *)fnx_sortByParallel:(id (^)(id obj))fn
 {
-    return (0 == self.count) ? [NSArray array] : self.reverseObjectEnumerator.allObjects;
+    NSParameterAssert(nil != fn);
+    NSUInteger count = self.count;
+    if (count < 2) {
+        return [self copy];
+    }
+    // keys doesn't retain what it points at, so keyArray has to outlive the sort.
+    __attribute__((objc_precise_lifetime)) NSArray *keyArray = [self fnx_mapParallel:fn];
+    __unsafe_unretained id *keys = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [keyArray getObjects:keys range:NSMakeRange(0, count)];
+    NSUInteger *indexes = (NSUInteger *)malloc(count * sizeof(NSUInteger));
+    NSUInteger *scratch = (NSUInteger *)malloc(count * sizeof(NSUInteger));
+    for (NSUInteger i = 0; i < count; ++i) {
+        indexes[i] = i;
+    }
+    // Sort each chunk on its own, then merge neighbouring runs pairwise, doubling their width each round.
+    // Every task works on its own range of indexes and scratch.
+    NSUInteger grainSize = [FNXParallel grainSizeForCount:count requestedGrainSize:0];
+    [FNXParallel forChunksOfCount:count grainSize:grainSize block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        FNXSortIndexes(indexes, scratch, range.location, NSMaxRange(range), keys);
+    }];
+    for (NSUInteger width = grainSize; width < count; width *= 2) {
+        NSUInteger mergeCount = (count + 2 * width - 1) / (2 * width);
+        [FNXParallel forChunksOfCount:mergeCount grainSize:1 block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+            NSUInteger lo = chunk * 2 * width;
+            FNXMergeIndexes(indexes, scratch, lo, MIN(lo + width, count), MIN(lo + 2 * width, count), keys);
+        }];
+    }
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    NSArray *result = FNXArrayOfObjectsAtIndexes(objects, indexes, count);
+    free(objects);
+    free(scratch);
+    free(indexes);
+    free(keys);
+    return result;
 }
 
-// Returns a dictionary assuming that this collection contains elements that are FNXTuple2 objects, where _1 is the
-// key and _2 is the value.
-- (NSDictionary *)fnx_toDictionary
+@end
+
+
+@implementation NSArray (FNXAsync)
+
+- (FNXFuture *)fnx_mapAsync:(id (^)(id obj))fn maxConcurrent:(NSUInteger)maxConcurrent queue:(dispatch_queue_t)queue
+{
+    NSParameterAssert(nil != fn);
+    return [self fnx_traverseAsync:^FNXFuture *(id obj) {
+        return [FNXFuture futureOnQueue:queue block:^id {
+            return fn(obj);
+        }];
+    } maxConcurrent:maxConcurrent];
+}
+
+- (FNXFuture *)fnx_traverseAsync:(FNXFuture *(^)(id obj))fn
+{
+    return [self fnx_traverseAsync:fn maxConcurrent:NSUIntegerMax];
+}
+
+- (FNXFuture *)fnx_traverseAsync:(FNXFuture *(^)(id obj))fn maxConcurrent:(NSUInteger)maxConcurrent
+{
+    return [FNXFuture futureByTraversing:self maxConcurrent:maxConcurrent fn:fn];
+}
+
+@end
+
+
+@implementation NSArray (FNXAutoreleaseBatching)
+
+- (id)fnx_foldLeftWithStartValue:(id)startValue
+                              op:(id (^)(id accumulator, id obj))op
+                autoreleaseEvery:(NSUInteger)batchSize
+{
+    NSParameterAssert(nil != op);
+    batchSize = batchSize ?: [FNXAutoreleaseBatching defaultBatchSize];
+    if (0 == batchSize) {
+        return [self fnx_foldLeftWithStartValue:startValue op:op];
+    }
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
+    // The accumulator is strong, so it outlives the pool it was returned into.
+    __block id accumulator = startValue;
+    FNXForRangesInAutoreleasePools(self.count, batchSize, ^(NSRange range) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            accumulator = op(accumulator, self[i]);
+        }
+    });
+    return accumulator;
+}
+
+- (void)fnx_foreach:(void (^)(id obj))fn autoreleaseEvery:(NSUInteger)batchSize
+{
+    NSParameterAssert(nil != fn);
+    batchSize = batchSize ?: [FNXAutoreleaseBatching defaultBatchSize];
+    if (0 == batchSize) {
+        [self fnx_foreach:fn];
+        return;
+    }
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
+    FNXForRangesInAutoreleasePools(self.count, batchSize, ^(NSRange range) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            fn(self[i]);
+        }
+    });
+}
+
+- (NSDictionary *)fnx_groupBy:(id (^)(id obj))fn autoreleaseEvery:(NSUInteger)batchSize
 {
+    NSParameterAssert(nil != fn);
+    batchSize = batchSize ?: [FNXAutoreleaseBatching defaultBatchSize];
+    if (0 == batchSize) {
+        return [self fnx_groupBy:fn];
+    }
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
     NSMutableDictionary *result = [NSMutableDictionary dictionary];
-    for (FNXTuple2 *tuple2 in self) {
-        result[tuple2._1] = tuple2._2;
+    FNXForRangesInAutoreleasePools(self.count, batchSize, ^(NSRange range) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            id obj = self[i];
+            id key = fn(obj);
+            NSMutableArray *collectionForKey = result[key];
+            if (nil == collectionForKey) {
+                collectionForKey = [NSMutableArray array];
+                result[key] = collectionForKey;
+            }
+            [collectionForKey addObject:obj];
+        }
+    });
+    return FNXImmutableBuckets(result);
+}
+
+- (NSArray *)fnx_map:(id (^)(id obj))fn autoreleaseEvery:(NSUInteger)batchSize
+{
+    NSParameterAssert(nil != fn);
+    batchSize = batchSize ?: [FNXAutoreleaseBatching defaultBatchSize];
+    if (0 == batchSize) {
+        return [self fnx_map:fn];
     }
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
+    FNXForRangesInAutoreleasePools(self.count, batchSize, ^(NSRange range) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            [result addObject:fn(self[i])];
+        }
+    });
     return [result copy];
 }
 
 @end
 
 
+@implementation NSArray (FNXNumeric)
+
+// The smallest and largest values in this collection. Raises if the collection is empty.
+- (void)fnx_minMax:(double *)min max:(double *)max
+{
+    if (self.fnx_isEmpty) {
+        @throw [[NSException alloc] initWithName:@"FNXUnsupportedOperation"
+                                          reason:NSLocalizedString(@"empty.minMax", @"Message when [NSArray fnx_minMax] is called")
+                                        userInfo:nil];
+    }
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    double *values = FNXCopyDoubleValues(objects, count);
+    NSUInteger minIndex, maxIndex;
+    FNXDoubleIndexesOfMinMax(values, count, &minIndex, &maxIndex);
+    if (NULL != min) {
+        *min = values[minIndex];
+    }
+    if (NULL != max) {
+        *max = values[maxIndex];
+    }
+    free(values);
+    free(objects);
+}
+
+// Computes the count, sum, min, max, mean and variance of this collection in a single pass.
+- (FNXNumericStats)fnx_stats
+{
+    FNXNumericStats result = { 0, 0.0, NAN, NAN, NAN, NAN };
+    double mean = 0.0;
+    double m2 = 0.0;
+    // Welford's algorithm keeps the variance numerically stable in a single pass.
+    for (NSNumber *obj in self) {
+        double value = obj.doubleValue;
+        result.count += 1;
+        result.sum += value;
+        if (1 == result.count) {
+            result.min = value;
+            result.max = value;
+        } else {
+            result.min = MIN(result.min, value);
+            result.max = MAX(result.max, value);
+        }
+        double delta = value - mean;
+        mean += delta / result.count;
+        m2 += delta * (value - mean);
+    }
+    if (result.count > 0) {
+        result.mean = mean;
+        result.variance = m2 / result.count;
+    }
+    return result;
+}
+
+// The sum of all elements in this collection, as a double.
+- (double)fnx_sumDouble
+{
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    double *values = FNXCopyDoubleValues(objects, count);
+    double result = 0.0;
+    for (NSUInteger i = 0; i < count; ++i) {
+        result += values[i];
+    }
+    free(values);
+    free(objects);
+    return result;
+}
+
+@end
+
+
 @implementation NSArray (FNXTraversableOnce)
 
 // Counts the number of elements in the collection which satisfy a predicate.
@@ -240,6 +1667,7 @@
 // Selects all elements of this collection which satisfy a predicate.
 - (NSArray *)fnx_filter:(BOOL (^)(id obj))pred
 {
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
     NSIndexSet *indexSet = [self indexesOfObjectsPassingTest:^BOOL(id obj, NSUInteger idx, BOOL *stop) {
         return pred(obj);
     }];
@@ -261,6 +1689,11 @@
 // op(...op(startValue, x_1), x_2, ..., x_n)
 - (id)fnx_foldLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op
 {
+    NSUInteger batchSize = [FNXAutoreleaseBatching defaultBatchSize];
+    if (0 != batchSize) {
+        return [self fnx_foldLeftWithStartValue:startValue op:op autoreleaseEvery:batchSize];
+    }
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
     id accumulator = startValue;
     for (id obj in self) {
         accumulator = op(accumulator, obj);
@@ -273,9 +1706,10 @@
 - (id)fnx_foldRightWithStartValue:(id)startValue op:(id (^)(id obj, id accumulator))op
 {
     NSParameterAssert(nil != op);
+    // Walk back by index rather than through a reverse enumerator.
     id accumulator = startValue;
-    for (id obj in self.reverseObjectEnumerator) {
-        accumulator = op(obj, accumulator);
+    for (NSUInteger i = self.count; i > 0; --i) {
+        accumulator = op(self[i - 1], accumulator);
     }
     return accumulator;
 }
@@ -295,6 +1729,12 @@
 // Applies a function fn to all elements of this collection.
 - (void)fnx_foreach:(void (^)(id obj))fn
 {
+    NSUInteger batchSize = [FNXAutoreleaseBatching defaultBatchSize];
+    if (0 != batchSize) {
+        [self fnx_foreach:fn autoreleaseEvery:batchSize];
+        return;
+    }
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
     NSParameterAssert(nil != fn);
     for (id obj in self) {
         fn(obj);
@@ -312,6 +1752,11 @@
 // should be mapped as FNXSome values.
 - (NSArray *)fnx_map:(id (^)(id obj))fn
 {
+    NSUInteger batchSize = [FNXAutoreleaseBatching defaultBatchSize];
+    if (0 != batchSize) {
+        return [self fnx_map:fn autoreleaseEvery:batchSize];
+    }
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
     NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
     for (id obj in self) {
         [result addObject:fn(obj)];
@@ -327,8 +1772,8 @@
                                           reason:NSLocalizedString(@"empty.max", @"Message when [NSArray fnx_max] is called")
                                         userInfo:nil];
     } else {
-        // Simplest implementation using KVO Collection Operators.
-        return [self valueForKeyPath: @"@max.self"];
+        // Fall back on the KVC collection operator for anything that can't be unboxed, e.g. NSDecimalNumber values.
+        return FNXNumericExtremum(self, YES) ?: [self valueForKeyPath: @"@max.self"];
     }
 }
 
@@ -340,8 +1785,8 @@
                                           reason:NSLocalizedString(@"empty.min", @"Message when [NSArray fnx_min] is called")
                                         userInfo:nil];
     } else {
-        // Simplest implementation using KVO Collection Operators.
-        return [self valueForKeyPath: @"@min.self"];
+        // Fall back on the KVC collection operator for anything that can't be unboxed, e.g. NSDecimalNumber values.
+        return FNXNumericExtremum(self, NO) ?: [self valueForKeyPath: @"@min.self"];
     }
 }
 
@@ -354,8 +1799,37 @@
 // The sum of all elements in this collection of NSNumber objects.
 - (NSNumber *)fnx_sum
 {
-    // Simplest implementation using KVO Collection Operators.
-    return [self valueForKeyPath: @"@sum.self"];
+    NSUInteger count = self.count;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+    [self getObjects:objects range:NSMakeRange(0, count)];
+    NSNumber *result = nil;
+    switch (FNXNumericKindOfObjects(objects, count)) {
+        case FNXNumericKindInteger: {
+            int64_t *values = FNXCopyInt64Values(objects, count);
+            int64_t sum = 0;
+            if (FNXSumInt64Values(values, count, &sum)) {
+                result = @(sum);
+            }
+            free(values);
+            break;
+        }
+        case FNXNumericKindDouble: {
+            double *values = FNXCopyDoubleValues(objects, count);
+            double sum = 0.0;
+            for (NSUInteger i = 0; i < count; ++i) {
+                sum += values[i];
+            }
+            result = @(sum);
+            free(values);
+            break;
+        }
+        case FNXNumericKindNone:
+            break;
+    }
+    free(objects);
+    // Fall back on the KVC collection operator for anything that can't be unboxed or that overflows an int64_t, since
+    // it accumulates in NSDecimalNumber.
+    return result ?: [self valueForKeyPath: @"@sum.self"];
 }
 
 // Selects all elements except the first.
@@ -363,8 +1837,7 @@
 {
     // This should throw an exception if the list is empty.
     NSRange range = NSMakeRange(1, self.count - 1);
-    NSIndexSet *indexSet = [NSIndexSet indexSetWithIndexesInRange:range];
-    return [self objectsAtIndexes:indexSet];
+    return [FNXArraySlice sliceWithArray:self range:range];
 }
 
 // Converts this traversable to an array.
@@ -385,14 +1858,14 @@
         return [NSArray array];
     } else {
         NSRange range = NSMakeRange(n, self.count - n);
-        NSIndexSet *indexSet = [NSIndexSet indexSetWithIndexesInRange:range];
-        return [self objectsAtIndexes:indexSet];
+        return [FNXArraySlice sliceWithArray:self range:range];
     }
 }
 
 // Selects all elements of this collection which do not satisfy a predicate.
 - (NSArray *)fnx_filterNot:(BOOL (^)(id obj))pred
 {
+    FNX_INSTRUMENT_OPERATOR(NSArray, self.count);
     NSIndexSet *indexSet = [self indexesOfObjectsPassingTest:^BOOL(id obj, NSUInteger idx, BOOL *stop) {
         return !pred(obj);
     }];
@@ -421,8 +1894,7 @@
 {
     // This should throw an exception if the collection is empty.
     NSRange range = NSMakeRange(0, self.count - 1);
-    NSIndexSet *indexSet = [NSIndexSet indexSetWithIndexesInRange:range];
-    return [self objectsAtIndexes:indexSet];
+    return [FNXArraySlice sliceWithArray:self range:range];
 }
 
 // Selects the last element.
@@ -472,8 +1944,7 @@
 {
     // This should throw an exception if the list is empty.
     NSRange range = NSMakeRange(1, self.count - 1);
-    NSIndexSet *indexSet = [NSIndexSet indexSetWithIndexesInRange:range];
-    return [self objectsAtIndexes:indexSet];
+    return [FNXArraySlice sliceWithArray:self range:range];
 }
 
 @end
@@ -13,16 +13,50 @@
  * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
  * (Rights  in Technical Data and Computer Software),  as applicable.
  *******************************************************************/
-
 #import <Foundation/Foundation.h>
 #import "FNXTraversable.h"
 
 
+// The entry operators below pass each key and value straight to their block, without allocating an FNXTuple2 per entry,
+// and size their results up front.
 @interface NSDictionary (FNXFunctionalExtensions)
 
+// Selects the entries of this dictionary which satisfy a predicate on both their key and value.
+- (NSDictionary *)fnx_filterEntries:(BOOL (^)(id key, id value))pred;
+
+// Selects the entries of this dictionary whose keys satisfy a predicate.
+- (NSDictionary *)fnx_filterKeys:(BOOL (^)(id key))pred;
+
+// Applies a binary operator to a start value and all entries of this dictionary, in enumeration order.
+- (id)fnx_foldEntriesWithStartValue:(id)startValue op:(id (^)(id accumulator, id key, id value))op;
+
+// Applies a function fn to all entries of this dictionary.
+- (void)fnx_foreachEntry:(void (^)(id key, id value))fn;
+
 // Builds a new collection by applying a function to all elements of this collection.
+// If every result is an FNXTuple2, they are collected into a dictionary of _1 to _2; otherwise into an array.
 - (id)fnx_map:(id (^)(id obj))fn; // <FNXTraversableOnce>
 
+// Builds a new dictionary with the same keys as this one, whose values are the results of applying fn to each entry.
+// If fn could return nil, it must return [FNXNone none] instead.
+- (NSDictionary *)fnx_mapValues:(id (^)(id key, id value))fn;
+
+@end
+
+
+// Data-parallel entry operators. The entries are split into contiguous chunks (see FNXParallel) which are processed
+// concurrently, so the blocks passed in must be safe to call from several threads at once.
+@interface NSDictionary (FNXParallel)
+
+// Selects the entries of this dictionary which satisfy a predicate, evaluating it in _parallel_.
+- (NSDictionary *)fnx_filterEntriesParallel:(BOOL (^)(id key, id value))pred;
+
+// Applies a function fn to all entries of this dictionary in _parallel_.
+- (void)fnx_foreachEntryParallel:(void (^)(id key, id value))fn;
+
+// Builds a new dictionary with the same keys as this one, applying fn to the entries in _parallel_.
+- (NSDictionary *)fnx_mapValuesParallel:(id (^)(id key, id value))fn;
+
 @end
 
 
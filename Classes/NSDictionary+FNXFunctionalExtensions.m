@@ -13,20 +13,97 @@
  * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
  * (Rights  in Technical Data and Computer Software),  as applicable.
  *******************************************************************/
-
 #import "NSDictionary+FNXFunctionalExtensions.h"
 #import "NSArray+FNXFunctionalExtensions.h"
 #import "FNXTuple2.h"
+#import "FNXParallel.h"
+#import "FNXInstrumentation.h"
+
+
+// Copies the keys and values of dictionary into keys and values, in enumeration order.
+// Both buffers must have room for dictionary.count entries; the entries remain owned by the dictionary.
+static void FNXGetKeysAndValues(NSDictionary *dictionary, __unsafe_unretained id *keys, __unsafe_unretained id *values)
+{
+    __block NSUInteger i = 0;
+    [dictionary enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+        keys[i] = key;
+        values[i] = value;
+        ++i;
+    }];
+}
 
 
 @implementation NSDictionary (FNXFunctionalExtensions)
 
+// Selects the entries of this dictionary which satisfy a predicate on both their key and value.
+- (NSDictionary *)fnx_filterEntries:(BOOL (^)(id key, id value))pred
+{
+    FNX_INSTRUMENT_OPERATOR(NSDictionary, self.count);
+    NSParameterAssert(nil != pred);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *keys = (__unsafe_unretained id *)malloc(MAX(count, (NSUInteger)1) * sizeof(id));
+    __unsafe_unretained id *values = (__unsafe_unretained id *)malloc(MAX(count, (NSUInteger)1) * sizeof(id));
+    __block NSUInteger selectedCount = 0;
+    [self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+        if (pred(key, value)) {
+            keys[selectedCount] = key;
+            values[selectedCount] = value;
+            ++selectedCount;
+        }
+    }];
+    NSDictionary *result = [NSDictionary dictionaryWithObjects:values forKeys:keys count:selectedCount];
+    free(values);
+    free(keys);
+    return result;
+}
+
+// Selects the entries of this dictionary whose keys satisfy a predicate.
+- (NSDictionary *)fnx_filterKeys:(BOOL (^)(id key))pred
+{
+    NSParameterAssert(nil != pred);
+    return [self fnx_filterEntries:^BOOL(id key, id value) {
+        return pred(key);
+    }];
+}
+
+// Applies a binary operator to a start value and all entries of this dictionary, in enumeration order.
+- (id)fnx_foldEntriesWithStartValue:(id)startValue op:(id (^)(id accumulator, id key, id value))op
+{
+    NSParameterAssert(nil != op);
+    __block id accumulator = startValue;
+    [self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+        accumulator = op(accumulator, key, value);
+    }];
+    return accumulator;
+}
+
+// Applies a function fn to all entries of this dictionary.
+- (void)fnx_foreachEntry:(void (^)(id key, id value))fn
+{
+    NSParameterAssert(nil != fn);
+    [self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+        fn(key, value);
+    }];
+}
+
 // Selects all elements except the last.
 - (id<FNXTraversable>)fnx_init
 {
     // This should throw an exception if the collection is empty.
-    NSArray *keysSelected = [[self.allKeys fnx_init] fnx_toArray];
-    return [self objectsForKeys:keysSelected notFoundMarker:[NSNull null]];
+    NSUInteger count = self.count;
+    if (0 == count) {
+        return [self.allKeys fnx_init];
+    }
+    // Collect the values of all but the last key in one pass, instead of copying the keys and looking them up again.
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:count - 1];
+    [self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+        if (result.count == count - 1) {
+            *stop = YES;
+        } else {
+            [result addObject:value];
+        }
+    }];
+    return [result copy];
 }
 
 // Tests whether this collection is empty.
@@ -40,7 +117,7 @@
 {
     // If all elements are FNXTuple2 objects, then an NSDictionary will be returned.
     // Otherwise, an NSArray will be returned.
-    BOOL allTuple2s = NO;
+    BOOL allTuple2s = YES;
     NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
     for (id obj in self) {
         id mapped = fn(obj);
@@ -58,6 +135,108 @@
     }
 }
 
+// Builds a new dictionary with the same keys as this one, whose values are the results of applying fn to each entry.
+- (NSDictionary *)fnx_mapValues:(id (^)(id key, id value))fn
+{
+    FNX_INSTRUMENT_OPERATOR(NSDictionary, self.count);
+    NSParameterAssert(nil != fn);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *keys = (__unsafe_unretained id *)malloc(MAX(count, (NSUInteger)1) * sizeof(id));
+    __strong id *values = (__strong id *)calloc(MAX(count, (NSUInteger)1), sizeof(id));
+    __block NSUInteger i = 0;
+    [self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+        keys[i] = key;
+        values[i] = fn(key, value);
+        ++i;
+    }];
+    NSDictionary *result = [NSDictionary dictionaryWithObjects:values forKeys:keys count:count];
+    for (NSUInteger j = 0; j < count; ++j) {
+        values[j] = nil;
+    }
+    free(values);
+    free(keys);
+    return result;
+}
+
+@end
+
+
+@implementation NSDictionary (FNXParallel)
+
+// Selects the entries of this dictionary which satisfy a predicate, evaluating it in _parallel_.
+- (NSDictionary *)fnx_filterEntriesParallel:(BOOL (^)(id key, id value))pred
+{
+    FNX_INSTRUMENT_OPERATOR(NSDictionary, self.count);
+    NSParameterAssert(nil != pred);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *keys = (__unsafe_unretained id *)malloc(MAX(count, (NSUInteger)1) * sizeof(id));
+    __unsafe_unretained id *values = (__unsafe_unretained id *)malloc(MAX(count, (NSUInteger)1) * sizeof(id));
+    FNXGetKeysAndValues(self, keys, values);
+    BOOL *selected = (BOOL *)malloc(MAX(count, (NSUInteger)1) * sizeof(BOOL));
+    [FNXParallel forChunksOfCount:count grainSize:0 block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            selected[i] = pred(keys[i], values[i]);
+        }
+    }];
+    // Compact the selected entries in place.
+    NSUInteger selectedCount = 0;
+    for (NSUInteger i = 0; i < count; ++i) {
+        if (selected[i]) {
+            keys[selectedCount] = keys[i];
+            values[selectedCount] = values[i];
+            ++selectedCount;
+        }
+    }
+    NSDictionary *result = [NSDictionary dictionaryWithObjects:values forKeys:keys count:selectedCount];
+    free(selected);
+    free(values);
+    free(keys);
+    return result;
+}
+
+// Applies a function fn to all entries of this dictionary in _parallel_.
+- (void)fnx_foreachEntryParallel:(void (^)(id key, id value))fn
+{
+    NSParameterAssert(nil != fn);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *keys = (__unsafe_unretained id *)malloc(MAX(count, (NSUInteger)1) * sizeof(id));
+    __unsafe_unretained id *values = (__unsafe_unretained id *)malloc(MAX(count, (NSUInteger)1) * sizeof(id));
+    FNXGetKeysAndValues(self, keys, values);
+    [FNXParallel forChunksOfCount:count grainSize:0 block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            fn(keys[i], values[i]);
+        }
+    }];
+    free(values);
+    free(keys);
+}
+
+// Builds a new dictionary with the same keys as this one, applying fn to the entries in _parallel_.
+- (NSDictionary *)fnx_mapValuesParallel:(id (^)(id key, id value))fn
+{
+    FNX_INSTRUMENT_OPERATOR(NSDictionary, self.count);
+    NSParameterAssert(nil != fn);
+    NSUInteger count = self.count;
+    __unsafe_unretained id *keys = (__unsafe_unretained id *)malloc(MAX(count, (NSUInteger)1) * sizeof(id));
+    __unsafe_unretained id *values = (__unsafe_unretained id *)malloc(MAX(count, (NSUInteger)1) * sizeof(id));
+    FNXGetKeysAndValues(self, keys, values);
+    // Each chunk writes to its own slots of a preallocated buffer, and the dictionary is built once at the end.
+    __strong id *mapped = (__strong id *)calloc(MAX(count, (NSUInteger)1), sizeof(id));
+    [FNXParallel forChunksOfCount:count grainSize:0 block:^(NSUInteger chunk, NSRange range, BOOL *stop) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) {
+            mapped[i] = fn(keys[i], values[i]);
+        }
+    }];
+    NSDictionary *result = [NSDictionary dictionaryWithObjects:mapped forKeys:keys count:count];
+    for (NSUInteger i = 0; i < count; ++i) {
+        mapped[i] = nil;
+    }
+    free(mapped);
+    free(values);
+    free(keys);
+    return result;
+}
+
 @end
 
 
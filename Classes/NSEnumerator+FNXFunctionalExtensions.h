@@ -17,10 +17,101 @@
 #import <Foundation/Foundation.h>
 #import "FNXTraversable.h"
 
+@class FNXFuture;
 
+
+// The transformers below are lazy: they pull from this enumerator only as their own elements are requested, so they
+// can be used over unbounded sources in constant memory. Like any enumerator, the results can be traversed only once.
 @interface NSEnumerator (FNXFunctionalExtensions)
+
+// Finds the first element of the collection satisfying a predicate, or nil if there is none.
+// Unlike fnx_find:, this doesn't allocate an option for the result.
+- (id)fnx_findValue:(BOOL (^)(id obj))pred;
+
+// Builds a new collection by applying a function to all elements of this collection
+// and using the elements of the resulting collections.
+- (NSEnumerator *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn;
+
+// Applies a binary operator to a start value and the elements of this collection, going left to right, like
+// fnx_foldLeftWithStartValue:op:, also passing each element's index. Setting *stop to YES ends the fold after the
+// current element, with the value op returned as the result.
+// Elements after the one that stopped the fold aren't consumed.
+- (id)fnx_foldLeftWhileWithStartValue:(id)startValue
+                                   op:(id (^)(id accumulator, id obj, NSUInteger idx, BOOL *stop))op;
+
+// Groups the elements of this enumerator into arrays of n consecutive elements; the last one is shorter when the
+// elements don't divide evenly. Only one group is held at a time.
+// Raises NSInvalidArgumentException if n is 0.
+- (NSEnumerator *)fnx_grouped:(NSUInteger)n;
+
+// Applies fn to the elements of this enumerator on workers threads, so the work overlaps with reading this enumerator
+// and with whatever consumes the result. This enumerator is read on a producer thread, in batches handed to the
+// workers through a bounded queue; at most bufferSize elements are held in between, and the producer blocks until
+// the consumer catches up. The results come out in the order of this enumerator.
+// Unlike the other transformers, fn must be safe to call from several threads at once, and this enumerator must not
+// be used elsewhere once the result has been read from. Raises NSInvalidArgumentException if workers or bufferSize
+// is 0.
+- (NSEnumerator *)fnx_pipe:(id (^)(id obj))fn workers:(NSUInteger)workers bufferSize:(NSUInteger)bufferSize;
+
+// Produces the running accumulations of op over this collection, going left to right: the start value, followed by
+// op(startValue, x_1), op(op(startValue, x_1), x_2), and so on.
+// Each accumulation is only computed when it's requested. startValue must not be nil.
+- (NSEnumerator *)fnx_scanLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op;
+
+// Produces arrays of size consecutive elements of this enumerator, starting every step elements; the last one is
+// shorter when the source runs out before filling it. Only the elements of one window are held, in a ring buffer.
+// Raises NSInvalidArgumentException if size or step is 0.
+- (NSEnumerator *)fnx_sliding:(NSUInteger)size step:(NSUInteger)step;
+
+// Selects the first n elements.
+- (NSEnumerator *)fnx_take:(NSUInteger)n;
+
+// Pairs up the elements of this enumerator with those of other as FNXTuple2 objects, until either is exhausted.
+- (NSEnumerator *)fnx_zip:(NSEnumerator *)other;
+
 @end
 
 
 @interface NSEnumerator (FNXIterable) <FNXIterable>
+
+// Selects all elements except first n ones.
+- (NSEnumerator *)fnx_drop:(NSUInteger)n;
+
+// Selects all elements of this collection which satisfy a predicate.
+- (NSEnumerator *)fnx_filter:(BOOL (^)(id obj))pred;
+
+// Selects all elements of this collection which do not satisfy a predicate.
+- (NSEnumerator *)fnx_filterNot:(BOOL (^)(id obj))pred;
+
+// Selects all elements except the last.
+// Unlike the strict collections, this doesn't raise for an empty enumerator.
+- (NSEnumerator *)fnx_init;
+
+// Builds a new collection by applying a function to all elements of this collection.
+// If fn could return nil, it must return [FNXNone none] instead and the other values
+// should be mapped as FNXSome values.
+- (NSEnumerator *)fnx_map:(id (^)(id obj))fn;
+
+// Selects all elements except the first.
+// Unlike the strict collections, this doesn't raise for an empty enumerator.
+- (NSEnumerator *)fnx_tail;
+
+@end
+
+
+// Asynchronous operators, like those of NSArray (FNXAsync). The enumerator is read under a lock from whichever thread
+// completes an element, so it mustn't be used elsewhere until the result completes.
+@interface NSEnumerator (FNXAsync)
+
+// Runs fn on every element on queue, at most maxConcurrent at a time. Elements are only pulled from this enumerator as
+// earlier ones complete, so a long source is read just a few elements ahead.
+- (FNXFuture *)fnx_mapAsync:(id (^)(id obj))fn maxConcurrent:(NSUInteger)maxConcurrent queue:(dispatch_queue_t)queue;
+
+// Collects the values of the futures fn returns for every element, reading the whole enumerator at once.
+- (FNXFuture *)fnx_traverseAsync:(FNXFuture *(^)(id obj))fn;
+
+// Collects the values of the futures fn returns for every element, with at most maxConcurrent of them pending at once.
+// Like fnx_mapAsync:maxConcurrent:queue:, this reads the enumerator only as slots free up.
+- (FNXFuture *)fnx_traverseAsync:(FNXFuture *(^)(id obj))fn maxConcurrent:(NSUInteger)maxConcurrent;
+
 @end
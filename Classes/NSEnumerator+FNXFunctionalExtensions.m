@@ -18,8 +18,85 @@
 #import "NSArray+FNXFunctionalExtensions.h"
 #import "FNXNone.h"
 #import "FNXSome.h"
+#import "FNXLazyEnumerator.h"
+#import "FNXFuture.h"
+
 
 @implementation NSEnumerator (FNXFunctionalExtensions)
+
+// Finds the first element of the collection satisfying a predicate, or nil if there is none.
+- (id)fnx_findValue:(BOOL (^)(id obj))pred
+{
+    // Pull one element at a time, since fast enumeration may fetch elements ahead of the one that decides the result.
+    id obj = nil;
+    while (nil != (obj = [self nextObject])) {
+        if (pred(obj)) {
+            return obj;
+        }
+    }
+    return nil;
+}
+
+// Builds a new collection by applying a function to all elements of this collection
+// and using the elements of the resulting collections.
+- (NSEnumerator *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn
+{
+    return [FNXFlatMappingEnumerator enumeratorWithSource:self fn:fn];
+}
+
+// Applies a binary operator to a start value and the elements of this collection, going left to right, until op sets
+// *stop to YES.
+- (id)fnx_foldLeftWhileWithStartValue:(id)startValue
+                                   op:(id (^)(id accumulator, id obj, NSUInteger idx, BOOL *stop))op
+{
+    NSParameterAssert(nil != op);
+    id accumulator = startValue;
+    NSUInteger index = 0;
+    BOOL stop = NO;
+    // Pull one element at a time, since fast enumeration may fetch elements ahead of the one that stops the fold.
+    id obj = nil;
+    while (!stop && nil != (obj = [self nextObject])) {
+        accumulator = op(accumulator, obj, index++, &stop);
+    }
+    return accumulator;
+}
+
+// Groups the elements of this enumerator into arrays of n consecutive elements.
+- (NSEnumerator *)fnx_grouped:(NSUInteger)n
+{
+    return [FNXSlidingEnumerator enumeratorWithSource:self size:n step:n];
+}
+
+// Applies fn to the elements of this enumerator on workers threads, with at most bufferSize elements in flight.
+- (NSEnumerator *)fnx_pipe:(id (^)(id obj))fn workers:(NSUInteger)workers bufferSize:(NSUInteger)bufferSize
+{
+    return [FNXPipeEnumerator enumeratorWithSource:self fn:fn workers:workers bufferSize:bufferSize];
+}
+
+// Produces the running accumulations of op over this collection, going left to right, starting with the start value.
+- (NSEnumerator *)fnx_scanLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op
+{
+    return [FNXScanningEnumerator enumeratorWithSource:self startValue:startValue op:op];
+}
+
+// Produces arrays of size consecutive elements of this enumerator, starting every step elements.
+- (NSEnumerator *)fnx_sliding:(NSUInteger)size step:(NSUInteger)step
+{
+    return [FNXSlidingEnumerator enumeratorWithSource:self size:size step:step];
+}
+
+// Selects the first n elements.
+- (NSEnumerator *)fnx_take:(NSUInteger)n
+{
+    return [FNXTakingEnumerator enumeratorWithSource:self count:n];
+}
+
+// Pairs up the elements of this enumerator with those of other as FNXTuple2 objects, until either is exhausted.
+- (NSEnumerator *)fnx_zip:(NSEnumerator *)other
+{
+    return [FNXZippingEnumerator enumeratorWithSource:self other:other];
+}
+
 @end
 
 
@@ -38,15 +115,17 @@
 }
 
 // Selects all elements except first n ones.
-- (id<FNXTraversable>)fnx_drop:(NSUInteger)n
+- (NSEnumerator *)fnx_drop:(NSUInteger)n
 {
-    return [self.allObjects fnx_drop:n];
+    return [FNXDroppingEnumerator enumeratorWithSource:self count:n];
 }
 
 // Tests whether a predicate holds for some of the elements of this traversable.
 - (BOOL)fnx_exists:(BOOL (^)(id obj))pred
 {
-    for (id obj in self) {
+    // One element at a time, like fnx_findValue:.
+    id obj = nil;
+    while (nil != (obj = [self nextObject])) {
         if (pred(obj)) {
             return YES;
         }
@@ -55,21 +134,26 @@
 }
 
 // Selects all elements of this collection which satisfy a predicate.
-- (id<FNXTraversable>)fnx_filter:(BOOL (^)(id obj))pred
+- (NSEnumerator *)fnx_filter:(BOOL (^)(id obj))pred
 {
-    return [self.allObjects fnx_filter:pred];
+    return [FNXFilteringEnumerator enumeratorWithSource:self pred:pred];
 }
 
 // Selects all elements of this collection which do not satisfy a predicate.
-- (id<FNXTraversable>)fnx_filterNot:(BOOL (^)(id obj))pred
+- (NSEnumerator *)fnx_filterNot:(BOOL (^)(id obj))pred
 {
-    return [self.allObjects fnx_filterNot:pred];
+    NSParameterAssert(nil != pred);
+    return [FNXFilteringEnumerator enumeratorWithSource:self pred:^BOOL(id obj) {
+        return !pred(obj);
+    }];
 }
 
 // Finds the first element of the collection satisfying a predicate, if any.
 - (id<FNXOption>)fnx_find:(BOOL (^)(id obj))pred
 {
-    for (id obj in self) {
+    // One element at a time, like fnx_findValue:.
+    id obj = nil;
+    while (nil != (obj = [self nextObject])) {
         if (pred(obj)) {
             return [FNXSome someWithValue:obj];
         }
@@ -92,13 +176,16 @@
 // op(x_1, op(x_2, ... op(x_n, z)...))
 - (id)fnx_foldRightWithStartValue:(id)startValue op:(id (^)(id obj, id accumulator))op
 {
+    // A right fold has to start from the last element, so the elements must be buffered.
     return [self.allObjects fnx_foldRightWithStartValue:startValue op:op];
 }
 
 // Tests whether a predicate holds for all elements of this collection.
 - (BOOL)fnx_forall:(BOOL (^)(id obj))pred
 {
-    for (id obj in self) {
+    // One element at a time, like fnx_findValue:.
+    id obj = nil;
+    while (nil != (obj = [self nextObject])) {
         if (!pred(obj)) {
             return NO;
         }
@@ -117,68 +204,86 @@
 // Selects the first element of this collection.
 - (id)fnx_head
 {
-    // We want this to throw an exception if out of bounds.
-    return self.allObjects[0];
+    id result = [self nextObject];
+    if (nil == result) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Head of empty enumerator", @"Message when [NSEnumerator fnx_head] is called")
+                                        userInfo:nil];
+    }
+    return result;
 }
 
 // Optionally selects the first element of this collection.
 - (id<FNXOption>)fnx_headOption
 {
-    return [self.allObjects fnx_headOption];
+    id result = [self nextObject];
+    return (nil != result) ? [FNXSome someWithValue:result] : [NSNull fnx_none];
 }
 
 // Selects the last element.
 - (id)fnx_last
 {
-    return [self.allObjects fnx_last];
+    id<FNXOption> result = self.fnx_lastOption;
+    if (result.fnx_isEmpty) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Last of empty enumerator", @"Message when [NSEnumerator fnx_last] is called")
+                                        userInfo:nil];
+    }
+    return result.fnx_get;
 }
 
 // Optionally selects the last element.
 - (id<FNXOption>)fnx_lastOption
 {
-    return [self.allObjects fnx_lastOption];
+    id result = nil;
+    for (id obj in self) {
+        result = obj;
+    }
+    return (nil != result) ? [FNXSome someWithValue:result] : [NSNull fnx_none];
 }
 
 // Selects all elements except the last.
-- (id<FNXTraversable>)fnx_init
+- (NSEnumerator *)fnx_init
 {
-    return [self.allObjects fnx_init];
+    return [FNXInitEnumerator enumeratorWithSource:self];
 }
 
 // Tests whether this collection is empty.
+// This consumes the first element, if there is one.
 - (BOOL)fnx_isEmpty
 {
-    return [self.allObjects fnx_isEmpty];
+    return nil == [self nextObject];
 }
 
 // Builds a new collection by applying a function to all elements of this collection.
 // If fn could return nil, it must return [FNXNone none] instead and the other values
 // should be mapped as FNXSome values.
-- (id<FNXTraversable>)fnx_map:(id (^)(id obj))fn
+- (NSEnumerator *)fnx_map:(id (^)(id obj))fn
 {
-    NSMutableArray *result = [NSMutableArray array];
-    for (id obj in self) {
-        [result addObject:fn(obj)];
-    }
-    return [result copy];
+    return [FNXMappingEnumerator enumeratorWithSource:self fn:fn];
 }
 
 // Tests whether the mutable indexed sequence is not empty.
+// This consumes the first element, if there is one.
 - (BOOL)fnx_nonEmpty
 {
-    return [self.allObjects fnx_nonEmpty];
+    return !self.fnx_isEmpty;
 }
 
 // The size of this collection.
 - (NSUInteger)fnx_size
 {
-    return self.allObjects.count;
+    NSUInteger result = 0;
+    for (id obj in self) {
+        result += 1;
+    }
+    return result;
 }
 
 // Selects all elements except the first.
-- (id<FNXTraversable>)fnx_tail
+- (NSEnumerator *)fnx_tail
 {
-    return [self.allObjects fnx_tail];
+    return [self fnx_drop:1];
 }
 
 // Converts this traversable to an array.
@@ -189,8 +294,33 @@
 
 - (NSEnumerator *)fnx_iterator
 {
-    // Create a fresh enumerator since enumerators can't be reset.
-    return self.allObjects.objectEnumerator;
+    // Enumerators can't be reset, so iterating continues from wherever this enumerator currently is.
+    return self;
+}
+
+@end
+
+
+@implementation NSEnumerator (FNXAsync)
+
+- (FNXFuture *)fnx_mapAsync:(id (^)(id obj))fn maxConcurrent:(NSUInteger)maxConcurrent queue:(dispatch_queue_t)queue
+{
+    NSParameterAssert(nil != fn);
+    return [self fnx_traverseAsync:^FNXFuture *(id obj) {
+        return [FNXFuture futureOnQueue:queue block:^id {
+            return fn(obj);
+        }];
+    } maxConcurrent:maxConcurrent];
+}
+
+- (FNXFuture *)fnx_traverseAsync:(FNXFuture *(^)(id obj))fn
+{
+    return [self fnx_traverseAsync:fn maxConcurrent:NSUIntegerMax];
+}
+
+- (FNXFuture *)fnx_traverseAsync:(FNXFuture *(^)(id obj))fn maxConcurrent:(NSUInteger)maxConcurrent
+{
+    return [FNXFuture futureByTraversing:self maxConcurrent:maxConcurrent fn:fn];
 }
 
 @end
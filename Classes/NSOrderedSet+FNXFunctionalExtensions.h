@@ -17,16 +17,64 @@
 #import <Foundation/Foundation.h>
 #import "FNXTraversable.h"
 
+@class FNXView;
+
 
 @interface NSOrderedSet (FNXFunctionalExtensions)
 
+// Finds the first element of the collection satisfying a predicate, or nil if there is none.
+// Unlike fnx_find:, this doesn't allocate an option for the result.
+- (id)fnx_findValue:(BOOL (^)(id obj))pred;
+
 // Builds a new collection by applying a function to all elements of this collection
-// and using the elements of the resulting collections.
+// and using the elements of the resulting collections. Equal elements are kept once, at their first position.
 - (NSOrderedSet *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn;
 
-// Returns a new collection with the elements of this collection in reversed order.
+// Applies a binary operator to a start value and the elements of this collection, going left to right, like
+// fnx_foldLeftWithStartValue:op:, also passing each element's index. Setting *stop to YES ends the fold after the
+// current element, with the value op returned as the result.
+- (id)fnx_foldLeftWhileWithStartValue:(id)startValue
+                                   op:(id (^)(id accumulator, id obj, NSUInteger idx, BOOL *stop))op;
+
+// Applies a function fn to all elements of this collection and their indexes.
+- (void)fnx_foreachWithIndex:(void (^)(id obj, NSUInteger idx))fn;
+
+// Partitions this collection into consecutive arrays of n elements, like [NSArray fnx_grouped:].
+- (NSArray *)fnx_grouped:(NSUInteger)n;
+
+// Builds a new ordered set by applying a function to all elements of this collection.
+// Equal results are kept once, at their first position.
+- (NSOrderedSet *)fnx_mapToOrderedSet:(id (^)(id obj))fn;
+
+// Returns a collection with the elements of this collection in reversed order.
+// The result is a view of this collection, so it's built without rehashing the elements. If this collection is
+// mutable, the view reflects later changes to it; copy the result if that isn't wanted.
 - (NSOrderedSet *)fnx_reverse;
 
+// Produces the running accumulations of op over this collection, going left to right: the start value, followed by
+// op(startValue, x_1), op(op(startValue, x_1), x_2), and so on.
+// The result is an array, since the accumulations may repeat.
+- (NSArray *)fnx_scanLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op;
+
+// Returns the windows of size consecutive elements of this collection, starting every step elements, like
+// [NSArray fnx_sliding:step:].
+- (NSArray *)fnx_sliding:(NSUInteger)size step:(NSUInteger)step;
+
+// Returns a lazy view of this collection, whose transformers are fused into a single pass.
+- (FNXView *)fnx_view;
+
+// Returns an array of FNXTuple2 pairs of corresponding elements of this collection and other, as long as the shorter
+// of the two. The pairs are only allocated when they're accessed.
+- (NSArray *)fnx_zip:(NSArray *)other;
+
+// Builds a new array by applying a function to corresponding elements of this collection and other, without
+// creating pairs. The result is as long as the shorter of the two.
+- (NSArray *)fnx_zip:(NSArray *)other with:(id (^)(id obj1, id obj2))fn;
+
+// Returns an array of FNXTuple2 pairs of each element of this collection and its index as an NSNumber.
+// The pairs are only allocated when they're accessed.
+- (NSArray *)fnx_zipWithIndex;
+
 @end
 
 
@@ -19,27 +19,129 @@
 #import "FNXSome.h"
 #import "FNXNone.h"
 #import "NSArray+FNXFunctionalExtensions.h"
+#import "FNXView.h"
+#import "FNXZippedArray.h"
+#import "FNXWindowedArray.h"
+#import "FNXInstrumentation.h"
 
 
 @implementation NSOrderedSet (FNXFunctionalExtensions)
 
+// Finds the first element of the collection satisfying a predicate, or nil if there is none.
+- (id)fnx_findValue:(BOOL (^)(id obj))pred
+{
+    for (id obj in self) {
+        if (pred(obj)) {
+            return obj;
+        }
+    }
+    return nil;
+}
+
 // Builds a new collection by applying a function to all elements of this collection
 // and using the elements of the resulting collections.
 - (NSOrderedSet *)fnx_flatMap:(id<FNXTraversableOnce> (^)(id obj))fn
 {
-    NSMutableArray *result = [NSMutableArray array];
+    NSMutableOrderedSet *result = [NSMutableOrderedSet orderedSet];
+    for (id obj in self) {
+        id<FNXTraversableOnce> elements = fn(obj);
+        // Stream the inner collection into the result rather than materializing it as an array first.
+        if ([elements conformsToProtocol:@protocol(NSFastEnumeration)]) {
+            for (id element in (id<NSFastEnumeration>)elements) {
+                [result addObject:element];
+            }
+        } else {
+            [elements fnx_foreach:^(id element) {
+                [result addObject:element];
+            }];
+        }
+    }
+    return [result copy];
+}
+
+// Applies a binary operator to a start value and the elements of this collection, going left to right, until op sets
+// *stop to YES.
+- (id)fnx_foldLeftWhileWithStartValue:(id)startValue
+                                   op:(id (^)(id accumulator, id obj, NSUInteger idx, BOOL *stop))op
+{
+    NSParameterAssert(nil != op);
+    id accumulator = startValue;
+    NSUInteger index = 0;
+    BOOL stop = NO;
+    for (id obj in self) {
+        accumulator = op(accumulator, obj, index++, &stop);
+        if (stop) {
+            break;
+        }
+    }
+    return accumulator;
+}
+
+// Applies a function fn to all elements of this collection and their indexes.
+- (void)fnx_foreachWithIndex:(void (^)(id obj, NSUInteger idx))fn
+{
+    NSUInteger index = 0;
+    for (id obj in self) {
+        fn(obj, index++);
+    }
+}
+
+// Partitions this collection into consecutive arrays of n elements.
+- (NSArray *)fnx_grouped:(NSUInteger)n
+{
+    return [FNXWindowedArray arrayWithWindowsOfArray:self.array size:n step:n];
+}
+
+// Builds a new ordered set by applying a function to all elements of this collection.
+- (NSOrderedSet *)fnx_mapToOrderedSet:(id (^)(id obj))fn
+{
+    NSMutableOrderedSet *result = [NSMutableOrderedSet orderedSetWithCapacity:self.count];
     for (id obj in self) {
-        [result addObjectsFromArray:fn(obj).fnx_toArray];
+        [result addObject:fn(obj)];
     }
-    return [NSOrderedSet orderedSetWithArray:result];
+    return [result copy];
 }
 
-// Returns a new collection with the elements of this collection in reversed order.
+// Returns a collection with the elements of this collection in reversed order.
 - (NSOrderedSet *)fnx_reverse
 {
-    return (0 == self.count)
-        ? [NSOrderedSet orderedSet]
-        : [NSOrderedSet orderedSetWithArray:self.reverseObjectEnumerator.allObjects];
+    return self.reversedOrderedSet;
+}
+
+// Produces the running accumulations of op over this collection, going left to right, starting with the start value.
+- (NSArray *)fnx_scanLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op
+{
+    return [self.array fnx_scanLeftWithStartValue:startValue op:op];
+}
+
+// Returns the windows of size consecutive elements of this collection, starting every step elements.
+- (NSArray *)fnx_sliding:(NSUInteger)size step:(NSUInteger)step
+{
+    return [FNXWindowedArray arrayWithWindowsOfArray:self.array size:size step:step];
+}
+
+// Returns a lazy view of this collection, whose transformers are fused into a single pass.
+- (FNXView *)fnx_view
+{
+    return [FNXView viewWithCollection:self];
+}
+
+// Returns an array of FNXTuple2 pairs of corresponding elements of this collection and other.
+- (NSArray *)fnx_zip:(NSArray *)other
+{
+    return [FNXZippedArray arrayByZipping:self.array with:other];
+}
+
+// Builds a new array by applying a function to corresponding elements of this collection and other.
+- (NSArray *)fnx_zip:(NSArray *)other with:(id (^)(id obj1, id obj2))fn
+{
+    return [self.array fnx_zip:other with:fn];
+}
+
+// Returns an array of FNXTuple2 pairs of each element of this collection and its index.
+- (NSArray *)fnx_zipWithIndex
+{
+    return [FNXZippedArray arrayByZippingWithIndex:self.array];
 }
 
 @end
@@ -85,6 +187,7 @@
 // Selects all elements of this collection which satisfy a predicate.
 - (id<FNXTraversable>)fnx_filter:(BOOL (^)(id obj))pred
 {
+    FNX_INSTRUMENT_OPERATOR(NSOrderedSet, self.count);
     NSIndexSet *indexSet = [self indexesOfObjectsPassingTest:^BOOL(id obj, NSUInteger idx, BOOL *stop) {
         return pred(obj);
     }];
@@ -115,6 +218,7 @@
 // op(...op(startValue, x_1), x_2, ..., x_n)
 - (id)fnx_foldLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op
 {
+    FNX_INSTRUMENT_OPERATOR(NSOrderedSet, self.count);
     id accumulator = startValue;
     for (id obj in self) {
         accumulator = op(accumulator, obj);
@@ -127,8 +231,8 @@
 - (id)fnx_foldRightWithStartValue:(id)startValue op:(id (^)(id obj, id accumulator))op
 {
     id accumulator = startValue;
-    for (id obj in self.reverseObjectEnumerator) {
-        accumulator = op(obj, accumulator);
+    for (NSUInteger i = self.count; i > 0; --i) {
+        accumulator = op(self[i - 1], accumulator);
     }
     return accumulator;
 }
@@ -206,6 +310,7 @@
 // should be mapped as FNXSome values.
 - (id<FNXTraversable>)fnx_map:(id (^)(id obj))fn
 {
+    FNX_INSTRUMENT_OPERATOR(NSOrderedSet, self.count);
     NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
     for (id obj in self) {
         [result addObject:fn(obj)];
@@ -17,8 +17,35 @@
 #import <Foundation/Foundation.h>
 #import "FNXTraversable.h"
 
+@class FNXTuple2;
+@class FNXView;
 
+
+// Scala-style functional extensions for NSSet.
+// The order of a set's elements is its enumeration order, so head, last, init, tail and drop are only meaningful for a
+// given set instance. The operators that select elements return sets.
 @interface NSSet (FNXFunctionalExtensions) <FNXIterable>
+
+// Finds the first element of the collection satisfying a predicate, or nil if there is none.
+// Unlike fnx_find:, this doesn't allocate an option for the result.
+- (id)fnx_findValue:(BOOL (^)(id obj))pred;
+
+// Partitions this collection into a dictionary of sets according to some discriminator function, fn. The
+// discriminator function should return an object representing which bucket the object must be placed into and that will
+// be used as a key in the resultant dictionary.
+- (NSDictionary *)fnx_groupBy:(id (^)(id obj))fn;
+
+// Builds a new set by applying a function to all elements of this collection. Equal results are kept once.
+- (NSSet *)fnx_mapToSet:(id (^)(id obj))fn;
+
+// Partitions this collection in two sets according to a predicate.
+// Returns a pair of NSSet objects. The first set consists of all elements that satisfy the predicate pred and the
+// second set consists of all elements that don't.
+- (FNXTuple2 *)fnx_partition:(BOOL (^)(id obj))pred;
+
+// Returns a lazy view of this collection, whose transformers are fused into a single pass.
+- (FNXView *)fnx_view;
+
 @end
 
 
@@ -31,7 +58,7 @@
 - (BOOL)fnx_exists:(BOOL (^)(id obj))pred;
 
 // Selects all elements of this collection which satisfy a predicate.
-- (id<FNXTraversable>)fnx_filter:(BOOL (^)(id obj))pred;
+- (NSSet *)fnx_filter:(BOOL (^)(id obj))pred;
 
 // Finds the first element of the collection satisfying a predicate, if any.
 - (id<FNXOption>)fnx_find:(BOOL (^)(id obj))pred;
@@ -70,10 +97,10 @@
 @interface NSSet (FNXTraversable)
 
 // Selects all elements except first n ones.
-- (id<FNXTraversable>)fnx_drop:(NSUInteger)n;
+- (NSSet *)fnx_drop:(NSUInteger)n;
 
 // Selects all elements of this collection which do not satisfy a predicate.
-- (id<FNXTraversable>)fnx_filterNot:(BOOL (^)(id obj))pred;
+- (NSSet *)fnx_filterNot:(BOOL (^)(id obj))pred;
 
 // Selects the first element of this collection.
 - (id)fnx_head;
@@ -82,7 +109,7 @@
 - (id<FNXOption>)fnx_headOption;
 
 // Selects all elements except the last.
-- (id<FNXTraversable>)fnx_init;
+- (NSSet *)fnx_init;
 
 // Selects the last element.
 - (id)fnx_last;
@@ -94,7 +121,7 @@
 - (BOOL)fnx_nonEmpty;
 
 // Selects all elements except the first.
-- (id<FNXTraversable>)fnx_tail;
+- (NSSet *)fnx_tail;
 
 @end
 
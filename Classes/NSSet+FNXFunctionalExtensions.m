@@ -18,9 +18,86 @@
 #import "NSArray+FNXFunctionalExtensions.h"
 #import "FNXNone.h"
 #import "FNXSome.h"
+#import "FNXTuple2.h"
+#import "FNXView.h"
+#import "FNXInstrumentation.h"
+
+
+// Returns the last element of set in enumeration order, or nil if the set is empty.
+static id FNXLastObject(NSSet *set)
+{
+    id last = nil;
+    for (id obj in set) {
+        last = obj;
+    }
+    return last;
+}
 
 
 @implementation NSSet (FNXFunctionalExtensions)
+
+// Finds the first element of the collection satisfying a predicate, or nil if there is none.
+- (id)fnx_findValue:(BOOL (^)(id obj))pred
+{
+    for (id obj in self) {
+        if (pred(obj)) {
+            return obj;
+        }
+    }
+    return nil;
+}
+
+// Partitions this collection into a dictionary of sets according to some discriminator function, fn.
+- (NSDictionary *)fnx_groupBy:(id (^)(id obj))fn
+{
+    NSMutableDictionary *buckets = [NSMutableDictionary dictionary];
+    for (id obj in self) {
+        id key = fn(obj);
+        NSMutableSet *bucket = buckets[key];
+        if (nil == bucket) {
+            bucket = [NSMutableSet set];
+            buckets[key] = bucket;
+        }
+        [bucket addObject:obj];
+    }
+    NSMutableDictionary *result = [NSMutableDictionary dictionaryWithCapacity:buckets.count];
+    [buckets enumerateKeysAndObjectsUsingBlock:^(id key, NSMutableSet *bucket, BOOL *stop) {
+        result[key] = [bucket copy];
+    }];
+    return [result copy];
+}
+
+// Builds a new set by applying a function to all elements of this collection.
+- (NSSet *)fnx_mapToSet:(id (^)(id obj))fn
+{
+    NSMutableSet *result = [NSMutableSet setWithCapacity:self.count];
+    for (id obj in self) {
+        [result addObject:fn(obj)];
+    }
+    return [result copy];
+}
+
+// Partitions this collection in two sets according to a predicate.
+- (FNXTuple2 *)fnx_partition:(BOOL (^)(id obj))pred
+{
+    NSMutableSet *satisfies = [NSMutableSet set];
+    NSMutableSet *fails = [NSMutableSet set];
+    for (id obj in self) {
+        if (pred(obj)) {
+            [satisfies addObject:obj];
+        } else {
+            [fails addObject:obj];
+        }
+    }
+    return [FNXTuple2 tuple2With_1:[satisfies copy] _2:[fails copy]];
+}
+
+// Returns a lazy view of this collection, whose transformers are fused into a single pass.
+- (FNXView *)fnx_view
+{
+    return [FNXView viewWithCollection:self];
+}
+
 @end
 
 
@@ -50,13 +127,12 @@
 }
 
 // Selects all elements of this collection which satisfy a predicate.
-- (id<FNXTraversable>)fnx_filter:(BOOL (^)(id obj))pred
+- (NSSet *)fnx_filter:(BOOL (^)(id obj))pred
 {
-    NSArray *allObjects = self.allObjects;
-    NSIndexSet *indexSet = [allObjects indexesOfObjectsPassingTest:^BOOL(id obj, NSUInteger idx, BOOL *stop) {
+    FNX_INSTRUMENT_OPERATOR(NSSet, self.count);
+    return [self objectsPassingTest:^BOOL(id obj, BOOL *stop) {
         return pred(obj);
     }];
-    return [allObjects objectsAtIndexes:indexSet];
 }
 
 // Finds the first element of the collection satisfying a predicate, if any.
@@ -74,6 +150,7 @@
 // op(...op(startValue, x_1), x_2, ..., x_n)
 - (id)fnx_foldLeftWithStartValue:(id)startValue op:(id (^)(id accumulator, id obj))op
 {
+    FNX_INSTRUMENT_OPERATOR(NSSet, self.count);
     id accumulator = startValue;
     for (id obj in self) {
         accumulator = op(accumulator, obj);
@@ -122,6 +199,7 @@
 // should be mapped as FNXSome values.
 - (id<FNXTraversable>)fnx_map:(id (^)(id obj))fn
 {
+    FNX_INSTRUMENT_OPERATOR(NSSet, self.count);
     NSMutableArray *result = [NSMutableArray arrayWithCapacity:self.count];
     for (id obj in self) {
         [result addObject:fn(obj)];
@@ -147,65 +225,78 @@
 @implementation NSSet (FNXTraversable)
 
 // Selects all elements except first n ones.
-- (id<FNXTraversable>)fnx_drop:(NSUInteger)n
+- (NSSet *)fnx_drop:(NSUInteger)n
 {
     if (n >= self.count) {
-        return [NSArray array];
+        return [NSSet set];
     } else {
-        NSRange range = NSMakeRange(n, self.count - n);
-        NSIndexSet *indexSet = [NSIndexSet indexSetWithIndexesInRange:range];
-        return [self.allObjects objectsAtIndexes:indexSet];
+        NSMutableSet *result = [NSMutableSet setWithCapacity:self.count - n];
+        NSUInteger index = 0;
+        for (id obj in self) {
+            if (index >= n) {
+                [result addObject:obj];
+            }
+            ++index;
+        }
+        return [result copy];
     }
 }
 
 // Selects all elements of this collection which do not satisfy a predicate.
-- (id<FNXTraversable>)fnx_filterNot:(BOOL (^)(id obj))pred
+- (NSSet *)fnx_filterNot:(BOOL (^)(id obj))pred
 {
-    NSArray *allObjects = self.allObjects;
-    NSIndexSet *indexSet = [allObjects indexesOfObjectsPassingTest:^BOOL(id obj, NSUInteger idx, BOOL *stop) {
+    return [self objectsPassingTest:^BOOL(id obj, BOOL *stop) {
         return !pred(obj);
     }];
-    return [allObjects objectsAtIndexes:indexSet];
 }
 
 // Selects the first element of this collection.
 - (id)fnx_head
 {
-    // We want this to throw an exception if out of bounds.
-    return self.allObjects[0];
+    for (id obj in self) {
+        return obj;
+    }
+    @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                      reason:NSLocalizedString(@"Head of empty set", @"Message when [NSSet fnx_head] is called on an empty set")
+                                    userInfo:nil];
 }
 
 // Optionally selects the first element of this collection.
 - (id<FNXOption>)fnx_headOption
 {
-    if (self.count > 0) {
-        return [FNXSome someWithValue:self.allObjects[0]];
-    } else {
-        return [NSNull fnx_none];
+    for (id obj in self) {
+        return [FNXSome someWithValue:obj];
     }
+    return [NSNull fnx_none];
 }
 
 // Selects all elements except the last.
-- (id<FNXTraversable>)fnx_init
+- (NSSet *)fnx_init
 {
     // This should throw an exception if the collection is empty.
-    NSRange range = NSMakeRange(0, self.count - 1);
-    NSIndexSet *indexSet = [NSIndexSet indexSetWithIndexesInRange:range];
-    return [self.allObjects objectsAtIndexes:indexSet];
+    NSMutableSet *result = [self mutableCopy];
+    [result removeObject:self.fnx_last];
+    return [result copy];
 }
 
 // Selects the last element.
 - (id)fnx_last
 {
-    // This should throw an exception if the collection is empty.
-    return self.allObjects[self.count - 1];
+    id last = FNXLastObject(self);
+    if (nil == last) {
+        @throw [[NSException alloc] initWithName:@"ADFNXNoSuchElement"
+                                          reason:NSLocalizedString(@"Last of empty set", @"Message when [NSSet fnx_last] is called on an empty set")
+                                        userInfo:nil];
+    }
+    return last;
 }
 
 // Optionally selects the last element.
 - (id<FNXOption>)fnx_lastOption
 {
-    if (self.count > 0) {
-        return [FNXSome someWithValue:self.fnx_last];
+    id last = FNXLastObject(self);
+    if (nil != last) {
+        return [FNXSome someWithValue:last];
     } else {
         return [NSNull fnx_none];
     }
@@ -218,12 +309,12 @@
 }
 
 // Selects all elements except the first.
-- (id<FNXTraversable>)fnx_tail
+- (NSSet *)fnx_tail
 {
     // This should throw an exception if the list is empty.
-    NSRange range = NSMakeRange(1, self.count - 1);
-    NSIndexSet *indexSet = [NSIndexSet indexSetWithIndexesInRange:range];
-    return [self.allObjects objectsAtIndexes:indexSet];
+    NSMutableSet *result = [self mutableCopy];
+    [result removeObject:self.fnx_head];
+    return [result copy];
 }
 
 @end
@@ -0,0 +1,73 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+
+
+SPEC_BEGIN(FNXArraySliceSpec)
+
+describe(@"FNXArraySlice", ^{
+
+    NSArray *input = @[@(10), @(20), @(30), @(40), @(50)];
+
+    it(@"Should present the elements in its range", ^{
+        NSArray *slice = [FNXArraySlice sliceWithArray:input range:NSMakeRange(1, 3)];
+        [[theValue(slice.count) should] equal:@(3)];
+        [[slice[0] should] equal:@(20)];
+        [[slice should] equal:@[@(20), @(30), @(40)]];
+        [[theBlock(^{
+            [slice objectAtIndex:3];
+        }) should] raiseWithName:NSRangeException];
+    });
+
+    it(@"Should support fast enumeration", ^{
+        NSArray *slice = [FNXArraySlice sliceWithArray:input range:NSMakeRange(2, 3)];
+        NSMutableArray *result = [NSMutableArray array];
+        for (id obj in slice) {
+            [result addObject:obj];
+        }
+        [[result should] equal:@[@(30), @(40), @(50)]];
+    });
+
+    it(@"Should be able to slice a slice", ^{
+        NSArray *slice = [FNXArraySlice sliceWithArray:input range:NSMakeRange(1, 4)];
+        NSArray *result = [FNXArraySlice sliceWithArray:slice range:NSMakeRange(1, 2)];
+        [[result should] equal:@[@(30), @(40)]];
+    });
+
+    it(@"Should raise for a range out of bounds", ^{
+        [[theBlock(^{
+            [FNXArraySlice sliceWithArray:input range:NSMakeRange(4, 2)];
+        }) should] raiseWithName:NSRangeException];
+    });
+
+    it(@"Shouldn't change when a mutable source array changes", ^{
+        NSMutableArray *source = [input mutableCopy];
+        NSArray *slice = [FNXArraySlice sliceWithArray:source range:NSMakeRange(0, 2)];
+        source[0] = @(0);
+        [[slice should] equal:@[@(10), @(20)]];
+    });
+
+    it(@"Should be returned from drop, tail and init", ^{
+        [[[input fnx_drop:2] should] beKindOfClass:[FNXArraySlice class]];
+        [[[[input fnx_drop:2] fnx_tail] should] equal:@[@(40), @(50)]];
+        [[[input.fnx_init fnx_dropRight:1] should] equal:@[@(10), @(20), @(30)]];
+    });
+
+});
+
+SPEC_END
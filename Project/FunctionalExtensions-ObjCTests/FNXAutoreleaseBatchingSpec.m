@@ -0,0 +1,110 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+#import "FNXMockTrackedObject.h"
+
+
+// Returns the most temporaries alive at once while running block, over those alive before it.
+static NSUInteger peakTemporaries(void (^block)(void))
+{
+    NSUInteger before = [FNXMockTrackedObject liveCount];
+    [FNXMockTrackedObject resetPeakLiveCount];
+    @autoreleasepool {
+        block();
+    }
+    return [FNXMockTrackedObject peakLiveCount] - before;
+}
+
+
+SPEC_BEGIN(FNXAutoreleaseBatchingSpec)
+
+describe(@"FNXAutoreleaseBatching", ^{
+
+    NSMutableArray *numbers = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 10000; ++i) {
+        [numbers addObject:@(i)];
+    }
+    id (^identity)(id) = ^id(id obj) {
+        [FNXMockTrackedObject autoreleasedObject];
+        return obj;
+    };
+
+    afterEach(^{
+        [FNXAutoreleaseBatching setDefaultBatchSize:0];
+    });
+
+    it(@"Should keep all 10000 temporaries of a map alive, but at most 100 in batches of 100", ^{
+        __block NSArray *result = nil;
+        NSUInteger unbatched = peakTemporaries(^{
+            [numbers fnx_map:identity];
+        });
+        NSUInteger batched = peakTemporaries(^{
+            result = [numbers fnx_map:identity autoreleaseEvery:100];
+        });
+        [[theValue(unbatched) should] equal:@(10000)];
+        [[theValue(batched) should] beLessThanOrEqualTo:@(100)];
+        [[result should] equal:numbers];
+    });
+
+    it(@"Should keep at most 100 temporaries of foreach, foldLeft and groupBy alive in batches of 100", ^{
+        __block NSUInteger visited = 0;
+        NSUInteger foreachPeak = peakTemporaries(^{
+            [numbers fnx_foreach:^(id obj) {
+                [FNXMockTrackedObject autoreleasedObject];
+                visited += 1;
+            } autoreleaseEvery:100];
+        });
+        __block id sum = nil;
+        NSUInteger foldPeak = peakTemporaries(^{
+            sum = [numbers fnx_foldLeftWithStartValue:@(0) op:^id(NSNumber *acc, NSNumber *n) {
+                [FNXMockTrackedObject autoreleasedObject];
+                return @(acc.integerValue + n.integerValue);
+            } autoreleaseEvery:100];
+        });
+        __block NSDictionary *groups = nil;
+        NSUInteger groupPeak = peakTemporaries(^{
+            groups = [numbers fnx_groupBy:^id(NSNumber *n) {
+                [FNXMockTrackedObject autoreleasedObject];
+                return @(n.integerValue % 3);
+            } autoreleaseEvery:100];
+        });
+        [[theValue(foreachPeak) should] beLessThanOrEqualTo:@(100)];
+        [[theValue(foldPeak) should] beLessThanOrEqualTo:@(100)];
+        [[theValue(groupPeak) should] beLessThanOrEqualTo:@(100)];
+        [[theValue(visited) should] equal:@(10000)];
+        [[sum should] equal:@(49995000)];
+        [[groups[@(0)] should] haveCountOf:3334];
+    });
+
+    it(@"Should keep at most 50 temporaries of a plain map alive with a default batch size of 50", ^{
+        [FNXAutoreleaseBatching setDefaultBatchSize:50];
+        NSUInteger peak = peakTemporaries(^{
+            [numbers fnx_map:identity];
+        });
+        [[theValue(peak) should] beLessThanOrEqualTo:@(50)];
+    });
+
+    it(@"Should keep at most 100 temporaries per worker alive in parallel chunks of 100", ^{
+        NSUInteger peak = peakTemporaries(^{
+            [numbers fnx_mapParallel:identity grainSize:100];
+        });
+        NSUInteger workers = [NSProcessInfo processInfo].activeProcessorCount + 1;
+        [[theValue(peak) should] beLessThanOrEqualTo:@(100 * workers)];
+    });
+});
+
+SPEC_END
@@ -0,0 +1,60 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+
+
+SPEC_BEGIN(FNXDoubleArraySpec)
+
+describe(@"FNXDoubleArray", ^{
+
+    double values[] = {1.5, -2.0, 4.25, 0.5, 3.0};
+    FNXDoubleArray *array = [FNXDoubleArray arrayWithValues:values count:5];
+
+    it(@"Should convert to and from arrays of numbers", ^{
+        NSArray *numbers = @[@1.5, @-2.0, @4.25, @0.5, @3.0];
+        [[[FNXDoubleArray arrayWithNumbers:numbers] should] equal:array];
+        [[array.fnx_toArray should] equal:numbers];
+    });
+
+    it(@"Should run the kernels", ^{
+        [[theValue(array.sum) should] equal:7.25 withDelta:1e-12];
+        [[theValue([array dot:array]) should] equal:2.25 + 4.0 + 18.0625 + 0.25 + 9.0 withDelta:1e-12];
+        [[theValue(array.min) should] equal:theValue(-2.0)];
+        [[theValue(array.max) should] equal:theValue(4.25)];
+        [[[array scaledBy:2].fnx_toArray should] equal:@[@3.0, @-4.0, @8.5, @1.0, @6.0]];
+        [[[array valuesAbove:1.0].fnx_toArray should] equal:@[@1.5, @4.25, @3.0]];
+        [[array.prefixSums.fnx_toArray should] equal:@[@1.5, @-0.5, @3.75, @4.25, @7.25]];
+        [[theBlock(^{
+            [[FNXDoubleArray arrayWithNumbers:@[]] min];
+        }) should] raiseWithName:@"FNXUnsupportedOperation"];
+    });
+
+    it(@"Should implement the operators with C-typed blocks", ^{
+        FNXDoubleArray *halved = [array fnx_map:^double(double value) {
+            return value / 2;
+        }];
+        [[halved.fnx_toArray should] equal:@[@0.75, @-1.0, @2.125, @0.25, @1.5]];
+        [[theValue([array fnx_foldLeftWithStartValue:0 op:^double(double acc, double value) {
+            return MAX(acc, value);
+        }]) should] equal:theValue(4.25)];
+        [[[array fnx_filter:^BOOL(double value) {
+            return value < 1;
+        }].fnx_toArray should] equal:@[@-2.0, @0.5]];
+    });
+});
+
+SPEC_END
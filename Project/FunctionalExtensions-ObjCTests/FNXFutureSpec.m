@@ -0,0 +1,142 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+#import "FNXMockFreshObjectsEnumerator.h"
+
+
+SPEC_BEGIN(FNXFutureSpec)
+
+describe(@"FNXFuture", ^{
+
+    it(@"Should compose completed and failed futures", ^{
+        FNXFuture *doubled = [[FNXFuture futureWithValue:@(21)] fnx_map:^id(NSNumber *n) {
+            return @(n.intValue * 2);
+        }];
+        [[[doubled waitForResult].fnx_get should] equal:@(42)];
+        NSError *error = [NSError errorWithDomain:@"test" code:7 userInfo:nil];
+        FNXFuture *failed = [[FNXFuture futureWithError:error] fnx_flatMap:^FNXFuture *(id value) {
+            return [FNXFuture futureWithValue:value];
+        }];
+        [[theValue([failed waitForResult].fnx_isDefined) should] beNo];
+        [[failed.error should] equal:error];
+    });
+
+    it(@"Should complete once and tell its callbacks", ^{
+        FNXFuture *future = [FNXFuture future];
+        __block id received = nil;
+        [future onComplete:^(id<FNXOption> result) {
+            received = result.fnx_get;
+        }];
+        [[theValue(future.completed) should] beNo];
+        [[theValue([future completeWithValue:@"a"]) should] beYes];
+        [[theValue([future completeWithValue:@"b"]) should] beNo];
+        [future cancel];
+        [[received should] equal:@"a"];
+        [[theValue(future.cancelled) should] beNo];
+    });
+
+    it(@"Should map asynchronously in order without exceeding the concurrency limit", ^{
+        NSMutableArray *numbers = [NSMutableArray array];
+        for (NSUInteger i = 0; i < 50; ++i) {
+            [numbers addObject:@(i)];
+        }
+        NSLock *lock = [[NSLock alloc] init];
+        __block NSUInteger running = 0;
+        __block NSUInteger maxRunning = 0;
+        dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+        FNXFuture *future = [numbers fnx_mapAsync:^id(NSNumber *n) {
+            [lock lock];
+            running += 1;
+            maxRunning = MAX(maxRunning, running);
+            [lock unlock];
+            usleep((useconds_t)(50 - n.intValue) * 100);
+            [lock lock];
+            running -= 1;
+            [lock unlock];
+            return @(n.intValue * 2);
+        } maxConcurrent:4 queue:queue];
+        NSArray *result = [future waitForResultWithTimeout:10].fnx_get;
+        [[theValue(result.count) should] equal:@(50)];
+        [[result[0] should] equal:@(0)];
+        [[result[49] should] equal:@(98)];
+        [[theValue(maxRunning <= 4) should] beYes];
+    });
+
+    it(@"Should map an enumerator asynchronously", ^{
+        FNXFuture *future = [@[@"a", @"b", @"c"].objectEnumerator fnx_mapAsync:^id(NSString *s) {
+            return s.uppercaseString;
+        } maxConcurrent:2 queue:nil];
+        [[[future waitForResultWithTimeout:10].fnx_get should] equal:@[@"A", @"B", @"C"]];
+    });
+
+    it(@"Should keep the elements of an enumerator's batch alive until they're started", ^{
+        NSMutableArray *expected = [NSMutableArray array];
+        for (NSUInteger i = 0; i < 100; ++i) {
+            [expected addObject:[NSString stringWithFormat:@"%lu!", (unsigned long)i]];
+        }
+        NSEnumerator *strings = [FNXMockFreshObjectsEnumerator mockFreshObjectsEnumeratorWithCount:100];
+        FNXFuture *future = [strings fnx_mapAsync:^id(NSString *s) {
+            return [s stringByAppendingString:@"!"];
+        } maxConcurrent:1 queue:nil];
+        [[[future waitForResultWithTimeout:10].fnx_get should] equal:expected];
+    });
+
+    it(@"Should fail when an element has no value", ^{
+        FNXFuture *future = [@[@1, @2, @3] fnx_mapAsync:^id(NSNumber *n) {
+            return 2 == n.intValue ? nil : n;
+        } maxConcurrent:1 queue:nil];
+        [[theValue([future waitForResultWithTimeout:10].fnx_isDefined) should] beNo];
+        [[theValue(future.error.code) should] equal:@(FNXFutureErrorNoValue)];
+    });
+
+    it(@"Should stop starting elements once cancelled", ^{
+        NSMutableArray *numbers = [NSMutableArray array];
+        for (NSUInteger i = 0; i < 100; ++i) {
+            [numbers addObject:@(i)];
+        }
+        NSLock *lock = [[NSLock alloc] init];
+        __block NSUInteger started = 0;
+        FNXFuture *future = [numbers fnx_mapAsync:^id(id obj) {
+            [lock lock];
+            started += 1;
+            [lock unlock];
+            usleep(10000);
+            return obj;
+        } maxConcurrent:2 queue:nil];
+        usleep(25000);
+        [future cancel];
+        [[theValue(future.cancelled) should] beYes];
+        usleep(50000);
+        [lock lock];
+        [[theValue(started < 100) should] beYes];
+        [lock unlock];
+    });
+
+    it(@"Should traverse futures that are already complete without recursing", ^{
+        NSMutableArray *numbers = [NSMutableArray array];
+        for (NSUInteger i = 0; i < 100000; ++i) {
+            [numbers addObject:@(i)];
+        }
+        FNXFuture *future = [numbers fnx_traverseAsync:^FNXFuture *(id obj) {
+            return [FNXFuture futureWithValue:obj];
+        } maxConcurrent:1];
+        [[theValue(future.completed) should] beYes];
+        [[future.result.fnx_get should] equal:numbers];
+    });
+});
+
+SPEC_END
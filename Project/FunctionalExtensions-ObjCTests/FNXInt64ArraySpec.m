@@ -0,0 +1,94 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+
+
+SPEC_BEGIN(FNXInt64ArraySpec)
+
+describe(@"FNXInt64Array", ^{
+
+    int64_t values[] = {5, -3, 8, 0, 12, 7, -1};
+    FNXInt64Array *array = [FNXInt64Array arrayWithValues:values count:7];
+
+    it(@"Should convert to and from arrays of numbers", ^{
+        NSArray *numbers = @[@5, @-3, @8, @0, @12, @7, @-1];
+        [[[FNXInt64Array arrayWithNumbers:numbers] should] equal:array];
+        [[array.fnx_toArray should] equal:numbers];
+        [[theValue([array valueAtIndex:4]) should] equal:theValue(12)];
+        [[theBlock(^{
+            [array valueAtIndex:7];
+        }) should] raiseWithName:NSRangeException];
+    });
+
+    it(@"Should run the kernels", ^{
+        [[theValue(array.sum) should] equal:theValue(28)];
+        [[theValue([array dot:array]) should] equal:theValue(25 + 9 + 64 + 0 + 144 + 49 + 1)];
+        [[theValue(array.min) should] equal:theValue(-3)];
+        [[theValue(array.max) should] equal:theValue(12)];
+        [[[array scaledBy:2].fnx_toArray should] equal:@[@10, @-6, @16, @0, @24, @14, @-2]];
+        [[[array valuesAbove:5].fnx_toArray should] equal:@[@8, @12, @7]];
+        [[array.prefixSums.fnx_toArray should] equal:@[@5, @2, @10, @10, @22, @29, @28]];
+        FNXInt64Array *empty = [FNXInt64Array arrayWithNumbers:@[]];
+        [[theValue(empty.sum) should] equal:theValue(0)];
+        [[theBlock(^{
+            [empty max];
+        }) should] raiseWithName:@"FNXUnsupportedOperation"];
+        [[theBlock(^{
+            [array dot:empty];
+        }) should] raiseWithName:NSInvalidArgumentException];
+    });
+
+    it(@"Should agree with a fold on long arrays", ^{
+        NSMutableData *data = [NSMutableData dataWithLength:1001 * sizeof(int64_t)];
+        int64_t *longValues = (int64_t *)data.mutableBytes;
+        for (NSUInteger i = 0; i < 1001; ++i) {
+            longValues[i] = (int64_t)i * 3 - 700;
+        }
+        FNXInt64Array *longArray = [FNXInt64Array arrayWithValues:longValues count:1001];
+        int64_t folded = [longArray fnx_foldLeftWithStartValue:0 op:^int64_t(int64_t acc, int64_t value) {
+            return acc + value;
+        }];
+        [[theValue(longArray.sum) should] equal:theValue(folded)];
+        [[theValue([longArray.prefixSums fnx_last]) should] equal:theValue(folded)];
+    });
+
+    it(@"Should implement the operators with C-typed blocks", ^{
+        BOOL (^isPositive)(int64_t) = ^BOOL(int64_t value) {
+            return value > 0;
+        };
+        [[theValue([array fnx_count:isPositive]) should] equal:theValue(4)];
+        [[[array fnx_filter:isPositive].fnx_toArray should] equal:@[@5, @8, @12, @7]];
+        [[[array fnx_filterNot:isPositive].fnx_toArray should] equal:@[@-3, @0, @-1]];
+        [[[array fnx_map:^int64_t(int64_t value) {
+            return value * value;
+        }].fnx_toArray should] equal:@[@25, @9, @64, @0, @144, @49, @1]];
+        [[theValue([array fnx_foldRightWithStartValue:0 op:^int64_t(int64_t value, int64_t acc) {
+            return value - acc;
+        }]) should] equal:theValue(5 - (-3 - (8 - (0 - (12 - (7 - (-1 - 0)))))))];
+        [[theValue([array fnx_exists:^BOOL(int64_t value) { return 0 == value; }]) should] beYes];
+        [[theValue([array fnx_forall:isPositive]) should] beNo];
+        [[theValue(array.fnx_head) should] equal:theValue(5)];
+        [[theValue(array.fnx_last) should] equal:theValue(-1)];
+        [[[array fnx_drop:5].fnx_toArray should] equal:@[@7, @-1]];
+        [[array.fnx_tail.fnx_init.fnx_toArray should] equal:@[@-3, @8, @0, @12, @7]];
+        [[theBlock(^{
+            [[FNXInt64Array arrayWithNumbers:@[]] fnx_head];
+        }) should] raiseWithName:@"ADFNXNoSuchElement"];
+    });
+});
+
+SPEC_END
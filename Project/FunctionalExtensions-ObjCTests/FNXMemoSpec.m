@@ -0,0 +1,98 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+
+
+SPEC_BEGIN(FNXMemoSpec)
+
+describe(@"FNXMemo", ^{
+
+    it(@"Should invoke the block once per distinct input and count hits and misses", ^{
+        __block NSUInteger calls = 0;
+        FNXMemo *memo = [FNXMemo memoWithBlock:^id(NSString *s) {
+            calls += 1;
+            return s.uppercaseString;
+        } capacity:0];
+        NSArray *result = [@[@"a", @"b", @"a", @"a", @"c", @"b"] fnx_map:memo.block];
+        [[result should] equal:@[@"A", @"B", @"A", @"A", @"C", @"B"]];
+        [[theValue(calls) should] equal:@(3)];
+        [[theValue(memo.misses) should] equal:@(3)];
+        [[theValue(memo.hits) should] equal:@(3)];
+        [[theValue(memo.count) should] equal:@(3)];
+    });
+
+    it(@"Should evict the least recently used result when full", ^{
+        __block NSUInteger calls = 0;
+        FNXMemo *memo = [FNXMemo memoWithBlock:^id(NSNumber *n) {
+            calls += 1;
+            return @(n.intValue * 2);
+        } capacity:2];
+        [memo valueForObject:@(1)];
+        [memo valueForObject:@(2)];
+        [memo valueForObject:@(1)];
+        [memo valueForObject:@(3)];
+        [[theValue(memo.count) should] equal:@(2)];
+        [[theValue(calls) should] equal:@(3)];
+        // 2 was the least recently used, so it was evicted while 1 was kept.
+        [memo valueForObject:@(1)];
+        [[theValue(calls) should] equal:@(3)];
+        [[[memo valueForObject:@(2)] should] equal:@(4)];
+        [[theValue(calls) should] equal:@(4)];
+    });
+
+    it(@"Should forget its results when asked to", ^{
+        FNXMemo *memo = [FNXMemo memoWithBlock:^id(id obj) {
+            return obj;
+        } capacity:0];
+        [memo valueForObject:@"a"];
+        [memo removeAllValues];
+        [[theValue(memo.count) should] equal:@(0)];
+        [memo valueForObject:@"a"];
+        [[theValue(memo.misses) should] equal:@(2)];
+    });
+
+    it(@"Should be usable from several threads at once", ^{
+        NSMutableArray *input = [NSMutableArray array];
+        for (NSUInteger i = 0; i < 10000; ++i) {
+            [input addObject:@(i % 100)];
+        }
+        FNXMemo *memo = FNXMemoize(^id(NSNumber *n) {
+            return @(n.intValue * n.intValue);
+        });
+        [[theValue(memo.isConcurrent) should] beTrue];
+        NSArray *result = [input fnx_mapParallel:memo.block];
+        [[result should] equal:[input fnx_map:^id(NSNumber *n) {
+            return @(n.intValue * n.intValue);
+        }]];
+        [[theValue(memo.count) should] equal:@(100)];
+        [[theValue(memo.hits + memo.misses) should] equal:@(10000)];
+        [[theValue(memo.misses) should] beGreaterThanOrEqualTo:@(100)];
+    });
+
+    it(@"Should stay within its capacity when concurrent", ^{
+        FNXMemo *memo = [FNXMemo concurrentMemoWithBlock:^id(id obj) {
+            return obj;
+        } capacity:10];
+        for (NSUInteger i = 0; i < 1000; ++i) {
+            [memo valueForObject:@(i)];
+        }
+        [[theValue(memo.count) should] beLessThanOrEqualTo:@(10)];
+    });
+
+});
+
+SPEC_END
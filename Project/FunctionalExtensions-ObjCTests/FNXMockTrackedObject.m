@@ -0,0 +1,73 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import "FNXMockTrackedObject.h"
+
+
+static NSUInteger FNXMockLiveCount = 0;
+static NSUInteger FNXMockPeakLiveCount = 0;
+
+
+@implementation FNXMockTrackedObject
+
++ (FNXMockTrackedObject *)autoreleasedObject
+{
+    // Assigning to an autoreleasing variable puts the object in the pool even when the caller's ARC would otherwise
+    // take it straight from the return value.
+    __autoreleasing FNXMockTrackedObject *result = [[FNXMockTrackedObject alloc] init];
+    return result;
+}
+
++ (NSUInteger)liveCount
+{
+    @synchronized (self) {
+        return FNXMockLiveCount;
+    }
+}
+
++ (NSUInteger)peakLiveCount
+{
+    @synchronized (self) {
+        return FNXMockPeakLiveCount;
+    }
+}
+
++ (void)resetPeakLiveCount
+{
+    @synchronized (self) {
+        FNXMockPeakLiveCount = FNXMockLiveCount;
+    }
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        @synchronized ([FNXMockTrackedObject class]) {
+            FNXMockLiveCount += 1;
+            FNXMockPeakLiveCount = MAX(FNXMockPeakLiveCount, FNXMockLiveCount);
+        }
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    @synchronized ([FNXMockTrackedObject class]) {
+        FNXMockLiveCount -= 1;
+    }
+}
+
+@end
@@ -248,6 +248,23 @@ describe(@"FNXNone", ^{
             }];
             [[result.fnx_get should] equal:@(15)];
         });
+
+        it(@"Should call the else block", ^{
+            __block BOOL calledSome = NO;
+            __block BOOL calledNone = NO;
+            [input fnx_ifSome:^(id obj) {
+                calledSome = YES;
+            } else:^{
+                calledNone = YES;
+            }];
+            [[theValue(calledSome) should] beFalse];
+            [[theValue(calledNone) should] beTrue];
+        });
+
+        it(@"Should be iterable without being wrapped", ^{
+            [[((id)input.fnx_toIterable) should] beIdenticalTo:input];
+            [[input.fnx_iterator.allObjects should] equal:@[]];
+        });
     });
     
     context(@"NSObject", ^{
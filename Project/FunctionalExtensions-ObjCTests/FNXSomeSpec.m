@@ -251,6 +251,30 @@ describe(@"FNXSome", ^{
             }];
             [[result.fnx_get should] equal:@(10)];
         });
+
+        it(@"Should call the some block with the value", ^{
+            __block id value = nil;
+            __block BOOL calledNone = NO;
+            [input fnx_ifSome:^(id obj) {
+                value = obj;
+            } else:^{
+                calledNone = YES;
+            }];
+            [[value should] equal:@(10)];
+            [[theValue(calledNone) should] beFalse];
+        });
+
+        it(@"Should be iterable without being wrapped", ^{
+            [[((id)input.fnx_toIterable) should] beIdenticalTo:input];
+            [[input.fnx_iterator.allObjects should] equal:@[@(10)]];
+        });
+
+        it(@"Should return itself when mapping to the same value", ^{
+            id<FNXOption> result = [input fnx_map:^id(id obj) {
+                return obj;
+            }];
+            [[((id)result) should] beIdenticalTo:input];
+        });
     });
 
     context(@"NSObject", ^{
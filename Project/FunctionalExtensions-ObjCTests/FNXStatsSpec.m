@@ -0,0 +1,118 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+
+
+// A stand-in for a malloc-interposing allocation counter, advanced by hand.
+static uint64_t FNXStatsSpecAllocations = 0;
+
+static uint64_t FNXStatsSpecAllocationCount(void)
+{
+    return FNXStatsSpecAllocations;
+}
+
+
+SPEC_BEGIN(FNXStatsSpec)
+
+describe(@"FNXStats", ^{
+
+    NSArray *input = @[@(1), @(2), @(3), @(4)];
+
+    afterEach(^{
+        [FNXStats setEnabled:NO];
+        [FNXStats setAllocationCounter:NULL];
+        [FNXStats reset];
+    });
+
+    it(@"Shouldn't record anything while it's disabled", ^{
+        [FNXStats reset];
+        [input fnx_map:^id(NSNumber *n) {
+            return n;
+        }];
+        [[[FNXStats snapshot] should] equal:@{}];
+    });
+
+    it(@"Should write its snapshot as JSON", ^{
+        NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"FNXStatsSpec.json"];
+        NSError *error = nil;
+        [[theValue([FNXStats writeSnapshotToJSONFile:path error:&error]) should] beTrue];
+        NSData *data = [NSData dataWithContentsOfFile:path];
+        id json = [NSJSONSerialization JSONObjectWithData:data options:0 error:NULL];
+        [[json should] equal:[FNXStats snapshot]];
+        [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+    });
+
+#if FNX_INSTRUMENTATION
+    it(@"Should be compiled in by the Instrumented configuration", ^{
+        [[theValue([FNXStats isAvailable]) should] beYes];
+    });
+
+    it(@"Should record calls, elements and time while it's enabled", ^{
+        [FNXStats setEnabled:YES];
+        [[theValue([FNXStats isEnabled]) should] beYes];
+        [input fnx_map:^id(NSNumber *n) {
+            return n;
+        }];
+        [input fnx_map:^id(NSNumber *n) {
+            return n;
+        }];
+        NSDictionary *map = [FNXStats snapshot][@"NSArray"][@"fnx_map:"];
+        [[map[@"calls"] should] equal:@(2)];
+        [[map[@"elements"] should] equal:@(8)];
+        [[map[@"nanoseconds"] shouldNot] beNil];
+        [[map[@"allocations"] should] beNil];
+    });
+
+    it(@"Should record the allocations made during each call while an allocation counter is set", ^{
+        [FNXStats setEnabled:YES];
+        [FNXStats setAllocationCounter:FNXStatsSpecAllocationCount];
+        [input fnx_map:^id(NSNumber *n) {
+            FNXStatsSpecAllocations += 3;
+            return n;
+        }];
+        [[[FNXStats snapshot][@"NSArray"][@"fnx_map:"][@"allocations"] should] equal:@(12)];
+    });
+
+    it(@"Should record a forwarded call under the operator it forwarded to", ^{
+        [FNXStats setEnabled:YES];
+        [FNXAutoreleaseBatching setDefaultBatchSize:2];
+        [input fnx_map:^id(NSNumber *n) {
+            return n;
+        }];
+        [FNXAutoreleaseBatching setDefaultBatchSize:0];
+        NSDictionary *operators = [FNXStats snapshot][@"NSArray"];
+        [[operators[@"fnx_map:"] should] beNil];
+        [[operators[@"fnx_map:autoreleaseEvery:"][@"calls"] should] equal:@(1)];
+    });
+#else
+    it(@"Shouldn't be compiled in without FNX_INSTRUMENTATION", ^{
+        [[theValue([FNXStats isAvailable]) should] beNo];
+    });
+
+    it(@"Shouldn't record calls even when it's enabled", ^{
+        [FNXStats setEnabled:YES];
+        [[theValue([FNXStats isEnabled]) should] beNo];
+        [input fnx_map:^id(NSNumber *n) {
+            return n;
+        }];
+        [[[FNXStats snapshot] should] equal:@{}];
+    });
+#endif
+
+});
+
+SPEC_END
@@ -0,0 +1,132 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+
+
+static NSArray *numbersUpTo(NSUInteger n)
+{
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:n];
+    for (NSUInteger i = 0; i < n; ++i) {
+        [result addObject:@(i)];
+    }
+    return result;
+}
+
+
+SPEC_BEGIN(FNXVectorSpec)
+
+describe(@"FNXVector", ^{
+
+    it(@"Should hold its elements across trie levels", ^{
+        // 40000 elements need three levels of inner nodes above the leaves.
+        NSArray *numbers = numbersUpTo(40000);
+        FNXVector *built = [FNXVector vectorWithArray:numbers];
+        FNXVector *appended = [FNXVector vector];
+        for (id obj in numbers) {
+            appended = [appended vectorByAddingObject:obj];
+        }
+        [[theValue(built.count) should] equal:@(40000)];
+        [[built.fnx_toArray should] equal:numbers];
+        [[appended.fnx_toArray should] equal:numbers];
+        [[appended should] equal:built];
+        [[built[32767] should] equal:@(32767)];
+        [[built[32768] should] equal:@(32768)];
+        [[theBlock(^{
+            [built objectAtIndex:40000];
+        }) should] raiseWithName:NSRangeException];
+    });
+
+    it(@"Should leave the original unchanged when adding or replacing", ^{
+        FNXVector *v1 = [FNXVector vectorWithArray:numbersUpTo(100)];
+        FNXVector *v2 = [v1 vectorByAddingObject:@(100)];
+        FNXVector *v3 = [v1 vectorByReplacingObjectAtIndex:5 withObject:@"five"];
+        FNXVector *v4 = [v1 vectorByReplacingObjectAtIndex:99 withObject:@"last"];
+        [[v1.fnx_toArray should] equal:numbersUpTo(100)];
+        [[v2.fnx_toArray should] equal:numbersUpTo(101)];
+        [[v3[5] should] equal:@"five"];
+        [[v4[99] should] equal:@"last"];
+        [[v1[5] should] equal:@(5)];
+        [[v1[99] should] equal:@(99)];
+    });
+
+    it(@"Should slice and add to slices without affecting the original", ^{
+        FNXVector *vector = [FNXVector vectorWithArray:numbersUpTo(100)];
+        FNXVector *slice = [vector subvectorWithRange:NSMakeRange(30, 10)];
+        [[slice.fnx_toArray should] equal:[numbersUpTo(40) subarrayWithRange:NSMakeRange(30, 10)]];
+        FNXVector *extended = [slice vectorByAddingObject:@"x"];
+        [[theValue(extended.count) should] equal:@(11)];
+        [[extended.fnx_last should] equal:@"x"];
+        [[vector[40] should] equal:@(40)];
+        [[[vector fnx_drop:98].fnx_toArray should] equal:@[@98, @99]];
+        [[[vector fnx_take:2].fnx_toArray should] equal:@[@0, @1]];
+        [[vector.fnx_tail.fnx_head should] equal:@(1)];
+        [[vector.fnx_init.fnx_last should] equal:@(98)];
+        [[theBlock(^{
+            [vector subvectorWithRange:NSMakeRange(90, 11)];
+        }) should] raiseWithName:NSRangeException];
+    });
+
+    it(@"Should not change built vectors when the builder goes on adding", ^{
+        FNXVectorBuilder *builder = [FNXVectorBuilder builder];
+        [builder addObjectsFromCollection:numbersUpTo(70)];
+        FNXVector *first = [builder vector];
+        [builder addObjectsFromCollection:@[@"a", @"b"]];
+        FNXVector *second = [builder vector];
+        [[theValue(first.count) should] equal:@(70)];
+        [[first.fnx_toArray should] equal:numbersUpTo(70)];
+        [[theValue(second.count) should] equal:@(72)];
+        [[second.fnx_last should] equal:@"b"];
+    });
+
+    it(@"Should implement the traversable operators", ^{
+        FNXVector *vector = [FNXVector vectorWithArray:numbersUpTo(100)];
+        BOOL (^isEven)(id) = ^BOOL(NSNumber *n) {
+            return 0 == n.integerValue % 2;
+        };
+        [[theValue([vector fnx_filter:isEven].count) should] equal:@(50)];
+        [[[vector fnx_filterNot:isEven].fnx_head should] equal:@(1)];
+        [[[vector fnx_map:^id(NSNumber *n) {
+            return @(n.integerValue * 2);
+        }].fnx_last should] equal:@(198)];
+        [[[vector fnx_flatMap:^id<FNXTraversableOnce>(id obj) {
+            return @[obj, obj];
+        }] should] haveCountOf:200];
+        [[theValue([vector fnx_count:isEven]) should] equal:@(50)];
+        [[[vector fnx_foldLeftWithStartValue:@"" op:^id(NSString *acc, NSNumber *n) {
+            return n.integerValue < 3 ? [acc stringByAppendingString:n.stringValue] : acc;
+        }] should] equal:@"012"];
+        [[[vector fnx_foldRightWithStartValue:@"" op:^id(NSNumber *n, NSString *acc) {
+            return n.integerValue < 3 ? [acc stringByAppendingString:n.stringValue] : acc;
+        }] should] equal:@"210"];
+        [[theValue([vector fnx_forall:^BOOL(NSNumber *n) { return n.integerValue < 100; }]) should] beYes];
+        [[theValue([vector fnx_exists:^BOOL(NSNumber *n) { return n.integerValue == 50; }]) should] beYes];
+        [[[vector fnx_find:^BOOL(NSNumber *n) { return n.integerValue > 41; }].fnx_get should] equal:@(42)];
+        [[vector.fnx_iterator.allObjects should] equal:numbersUpTo(100)];
+        NSMutableArray *enumerated = [NSMutableArray array];
+        for (id obj in [vector fnx_drop:10]) {
+            [enumerated addObject:obj];
+        }
+        [[enumerated should] equal:[numbersUpTo(100) subarrayWithRange:NSMakeRange(10, 90)]];
+        [[theValue([FNXVector vector].fnx_isEmpty) should] beYes];
+        [[theValue([FNXVector vector].fnx_headOption.fnx_isEmpty) should] beYes];
+        [[theBlock(^{
+            [[FNXVector vector] fnx_head];
+        }) should] raiseWithName:@"ADFNXNoSuchElement"];
+    });
+});
+
+SPEC_END
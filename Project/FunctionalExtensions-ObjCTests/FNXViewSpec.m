@@ -0,0 +1,184 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+
+
+SPEC_BEGIN(FNXViewSpec)
+
+describe(@"FNXView", ^{
+
+    NSArray *input = @[@(10), @(20), @(30), @(40)];
+    NSArray *empty = @[];
+
+    context(@"Laziness", ^{
+
+        it(@"Shouldn't evaluate transformers until a terminal operation is invoked", ^{
+            __block NSUInteger calls = 0;
+            FNXView *view = [input.fnx_view fnx_map:^id(NSNumber *n) {
+                calls += 1;
+                return @(n.intValue * 2);
+            }];
+            [[theValue(calls) should] equal:@(0)];
+            [[view.fnx_toArray should] equal:@[@(20), @(40), @(60), @(80)]];
+            [[theValue(calls) should] equal:@(4)];
+        });
+
+        it(@"Should stop pulling elements once the first match is found", ^{
+            __block NSUInteger calls = 0;
+            id<FNXOption> result = [[[input.fnx_view fnx_filter:^BOOL(NSNumber *n) {
+                calls += 1;
+                return n.intValue >= 20;
+            }] fnx_map:^id(NSNumber *n) {
+                return @(n.intValue + 1);
+            }] fnx_headOption];
+            [[result.fnx_get should] equal:@(21)];
+            [[theValue(calls) should] equal:@(2)];
+        });
+
+        it(@"Should stop pulling elements once take is satisfied", ^{
+            __block NSUInteger calls = 0;
+            NSArray *result = [[[input.fnx_view fnx_map:^id(NSNumber *n) {
+                calls += 1;
+                return n;
+            }] fnx_take:2] fnx_toArray];
+            [[result should] equal:@[@(10), @(20)]];
+            [[theValue(calls) should] equal:@(2)];
+        });
+
+        it(@"Should stop pulling elements once a fold is stopped", ^{
+            __block NSUInteger calls = 0;
+            NSNumber *result = [[input.fnx_view fnx_map:^id(NSNumber *n) {
+                calls += 1;
+                return n;
+            }] fnx_foldLeftWhileWithStartValue:@(0) op:^id(NSNumber *acc, NSNumber *n, NSUInteger idx, BOOL *stop) {
+                *stop = (idx == 1);
+                return @(acc.intValue + n.intValue);
+            }];
+            [[result should] equal:@(30)];
+            [[theValue(calls) should] equal:@(2)];
+        });
+
+        it(@"Should be able to traverse the same view more than once", ^{
+            FNXView *view = [input.fnx_view fnx_drop:1];
+            [[view.fnx_toArray should] equal:@[@(20), @(30), @(40)]];
+            [[view.fnx_toArray should] equal:@[@(20), @(30), @(40)]];
+        });
+
+    });
+
+    context(@"<FNXTraversable>", ^{
+
+        it(@"Should select elements that satisfy a predicate", ^{
+            FNXView *view = [input.fnx_view fnx_filter:^BOOL(NSNumber *n) {
+                return n.intValue % 20 == 0;
+            }];
+            [[view.fnx_toArray should] equal:@[@(20), @(40)]];
+        });
+
+        it(@"Should select elements that don't satisfy a predicate", ^{
+            FNXView *view = [input.fnx_view fnx_filterNot:^BOOL(NSNumber *n) {
+                return n.intValue % 20 == 0;
+            }];
+            [[view.fnx_toArray should] equal:@[@(10), @(30)]];
+        });
+
+        it(@"Should drop and take elements", ^{
+            [[[input.fnx_view fnx_drop:2].fnx_toArray should] equal:@[@(30), @(40)]];
+            [[[input.fnx_view fnx_drop:10].fnx_toArray should] equal:@[]];
+            [[[input.fnx_view fnx_take:10].fnx_toArray should] equal:input];
+            [[[input.fnx_view fnx_take:0].fnx_toArray should] equal:@[]];
+        });
+
+        it(@"Should drop and take while a predicate holds", ^{
+            BOOL (^lessThan30)(NSNumber *) = ^BOOL(NSNumber *n) {
+                return n.intValue < 30;
+            };
+            [[[input.fnx_view fnx_dropWhile:lessThan30].fnx_toArray should] equal:@[@(30), @(40)]];
+            [[[input.fnx_view fnx_takeWhile:lessThan30].fnx_toArray should] equal:@[@(10), @(20)]];
+        });
+
+        it(@"Should flatten the results of flatMap", ^{
+            FNXView *view = [input.fnx_view fnx_flatMap:^id<FNXTraversableOnce>(NSNumber *n) {
+                if (n.intValue < 30) {
+                    return @[n, n];
+                } else {
+                    return [NSNull fnx_none];
+                }
+            }];
+            [[view.fnx_toArray should] equal:@[@(10), @(10), @(20), @(20)]];
+        });
+
+        it(@"Should select all elements except the first or the last", ^{
+            [[input.fnx_view.fnx_tail.fnx_toArray should] equal:@[@(20), @(30), @(40)]];
+            [[input.fnx_view.fnx_init.fnx_toArray should] equal:@[@(10), @(20), @(30)]];
+            [[empty.fnx_view.fnx_init.fnx_toArray should] equal:@[]];
+        });
+
+        it(@"Should return the first and last elements", ^{
+            [[input.fnx_view.fnx_head should] equal:@(10)];
+            [[input.fnx_view.fnx_last should] equal:@(40)];
+            [[theValue(empty.fnx_view.fnx_headOption.fnx_isEmpty) should] beTrue];
+            [[theValue(empty.fnx_view.fnx_lastOption.fnx_isEmpty) should] beTrue];
+            [[theBlock(^{
+                [empty.fnx_view fnx_head];
+            }) should] raise];
+        });
+
+        it(@"Should fold in both directions", ^{
+            id left = [input.fnx_view fnx_foldLeftWithStartValue:@"" op:^id(NSString *acc, NSNumber *n) {
+                return [acc stringByAppendingFormat:@"%@", n];
+            }];
+            id right = [input.fnx_view fnx_foldRightWithStartValue:@"" op:^id(NSNumber *n, NSString *acc) {
+                return [acc stringByAppendingFormat:@"%@", n];
+            }];
+            [[left should] equal:@"10203040"];
+            [[right should] equal:@"40302010"];
+        });
+
+        it(@"Should count, test and size elements", ^{
+            FNXView *view = input.fnx_view;
+            [[theValue([view fnx_count:^BOOL(NSNumber *n) { return n.intValue > 15; }]) should] equal:@(3)];
+            [[theValue([view fnx_exists:^BOOL(NSNumber *n) { return n.intValue == 30; }]) should] beTrue];
+            [[theValue([view fnx_forall:^BOOL(NSNumber *n) { return n.intValue > 15; }]) should] beFalse];
+            [[theValue(view.fnx_size) should] equal:@(4)];
+            [[theValue(view.fnx_nonEmpty) should] beTrue];
+            [[theValue(empty.fnx_view.fnx_isEmpty) should] beTrue];
+        });
+
+    });
+
+    context(@"Other collections", ^{
+
+        it(@"Should be available on NSOrderedSet", ^{
+            NSOrderedSet *orderedSet = [NSOrderedSet orderedSetWithArray:input];
+            [[[orderedSet.fnx_view fnx_drop:3].fnx_toArray should] equal:@[@(40)]];
+        });
+
+        it(@"Should be available on NSSet", ^{
+            NSSet *set = [NSSet setWithArray:input];
+            FNXView *view = [set.fnx_view fnx_filter:^BOOL(NSNumber *n) {
+                return n.intValue > 20;
+            }];
+            [[[NSSet setWithArray:view.fnx_toArray] should] equal:[NSSet setWithArray:@[@(30), @(40)]]];
+        });
+
+    });
+
+});
+
+SPEC_END
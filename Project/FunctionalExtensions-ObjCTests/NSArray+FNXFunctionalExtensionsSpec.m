@@ -43,6 +43,36 @@ describe(@"NSArray+FNXFunctionalExtensions", ^{
             
         });
         
+        it(@"Should be able to return values with distinct keys, preserving order", ^{
+            NSArray *input = @[@"apple", @"avocado", @"banana", @"cherry", @"blueberry"];
+            NSArray *result = [input fnx_distinctBy:^id(NSString *s) {
+                return [s substringToIndex:1];
+            }];
+            [[result should] equal:@[@"apple", @"banana", @"cherry"]];
+        });
+
+        context(@"Should be able to combine arrays as sets, preserving order", ^{
+
+            NSArray *input = @[@(10), @(20), @(30), @(20), @(40)];
+            NSArray *other = @[@(40), @(50), @(20), @(50)];
+
+            it(@"With union", ^{
+                [[[input fnx_union:other] should] equal:@[@(10), @(20), @(30), @(40), @(50)]];
+                [[[@[] fnx_union:other] should] equal:@[@(40), @(50), @(20)]];
+            });
+
+            it(@"With intersect", ^{
+                [[[input fnx_intersect:other] should] equal:@[@(20), @(40)]];
+                [[[input fnx_intersect:@[]] should] equal:@[]];
+            });
+
+            it(@"With diff", ^{
+                [[[input fnx_diff:other] should] equal:@[@(10), @(30)]];
+                [[[input fnx_diff:@[]] should] equal:@[@(10), @(20), @(30), @(40)]];
+            });
+
+        });
+
         context(@"Should be able to select all elements except the last n ones", ^{
             
             it(@"For a nonempty collection", ^{
@@ -89,6 +119,26 @@ describe(@"NSArray+FNXFunctionalExtensions", ^{
             
         });
         
+        context(@"Should be able to find the first element that satisfies a predicate without an option", ^{
+
+            NSArray *input = @[@(10), @(20), @(30)];
+
+            it(@"Where the predicate is satisfied", ^{
+                id result = [input fnx_findValue:^BOOL(NSNumber *n) {
+                    return n.intValue > 15;
+                }];
+                [[result should] equal:@(20)];
+            });
+
+            it(@"Where the predicate isn't satisfied", ^{
+                id result = [input fnx_findValue:^BOOL(NSNumber *n) {
+                    return n.intValue > 50;
+                }];
+                [[result should] beNil];
+            });
+
+        });
+
         context(@"Should be able to partition elements based on a discriminator function", ^{
             
             id (^discriminate)(id) = ^id (NSNumber *obj) {
@@ -117,6 +167,28 @@ describe(@"NSArray+FNXFunctionalExtensions", ^{
             
         });
 
+        context(@"Should be able to reduce the buckets of a discriminator function", ^{
+
+            id (^parity)(id) = ^id (NSNumber *obj) {
+                return (obj.intValue % 2 == 0) ? @"even" : @"odd";
+            };
+            id (^sum)(id, id) = ^id (NSNumber *acc, NSNumber *obj) {
+                return @(acc.intValue + obj.intValue);
+            };
+
+            it(@"For a nonempty collection", ^{
+                NSArray *input = @[@(1), @(2), @(3), @(4), @(5)];
+                NSDictionary *result = [input fnx_groupBy:parity reduce:sum];
+                [[result should] equal:@{ @"even": @(6), @"odd": @(9) }];
+            });
+
+            it(@"For an empty collection", ^{
+                NSDictionary *result = [@[] fnx_groupBy:parity reduce:sum];
+                [[theValue(result.count) should] equal:@(0)];
+            });
+
+        });
+
         context(@"Should be able to map the elements to a dictionary", ^{
             
             it(@"For a nonempty collection", ^{
@@ -199,6 +271,44 @@ describe(@"NSArray+FNXFunctionalExtensions", ^{
             });
             
         });
+
+        it(@"Should be able to map elements, invoking the function once per distinct element", ^{
+            __block NSUInteger calls = 0;
+            NSArray *result = [@[@"x", @"y", @"x", @"x"] fnx_mapMemoized:^id(NSString *s) {
+                calls += 1;
+                return [s stringByAppendingString:s];
+            }];
+            [[result should] equal:@[@"xx", @"yy", @"xx", @"xx"]];
+            [[theValue(calls) should] equal:@(2)];
+        });
+
+        context(@"Should be able to use selectors as functions", ^{
+
+            it(@"To select elements, even of different classes", ^{
+                FNXMockWithBOOL *yes = [FNXMockWithBOOL mockWithBOOL:YES];
+                NSArray *input = @[yes, [FNXMockWithBOOL mockWithBOOL:NO], @(1), @(0), yes];
+                [[[input fnx_filterWithSelector:@selector(boolValue)] should] equal:@[yes, @(1), yes]];
+            });
+
+            it(@"To map elements, even of different classes", ^{
+                NSArray *input = @[@"a", @"b", @(10), @"c"];
+                NSArray *expected = @[@"a", @"b", @"10", @"c"];
+                [[[input fnx_mapWithSelector:@selector(description)] should] equal:expected];
+            });
+
+            it(@"To sort elements, keeping equal elements in their original order", ^{
+                NSArray *input = @[@"b", @"A", @"a", @"B"];
+                NSArray *expected = @[@"A", @"a", @"b", @"B"];
+                [[[input fnx_sortWithSelector:@selector(caseInsensitiveCompare:)] should] equal:expected];
+            });
+
+            it(@"For an empty collection", ^{
+                [[[@[] fnx_filterWithSelector:@selector(boolValue)] should] equal:@[]];
+                [[[@[] fnx_mapWithSelector:@selector(description)] should] equal:@[]];
+                [[[@[] fnx_sortWithSelector:@selector(compare:)] should] equal:@[]];
+            });
+
+        });
         
         context(@"Should be able to make a string from the elements of the collection", ^{
             
@@ -231,7 +341,139 @@ describe(@"NSArray+FNXFunctionalExtensions", ^{
             });
             
         });
+
+        context(@"Should be able to make a string from the elements of the collection using start, end and separator strings", ^{
+
+            it(@"For a nonempty collection", ^{
+                NSArray *input = @[@"a", @(20), @"c"];
+                [[[input fnx_mkStringWithStart:@"[" sep:@", " end:@"]"] should] equal:@"[a, 20, c]"];
+            });
+
+            it(@"For an empty collection", ^{
+                [[[@[] fnx_mkStringWithStart:@"[" sep:@", " end:@"]"] should] equal:@"[]"];
+            });
+
+        });
+
+        context(@"Should be able to write a string made from the elements of the collection to a stream", ^{
+
+            NSString *(^writeToMemory)(NSArray *) = ^NSString *(NSArray *input) {
+                NSOutputStream *stream = [NSOutputStream outputStreamToMemory];
+                [stream open];
+                NSError *error = nil;
+                BOOL success = [input fnx_mkStringToStream:stream start:@"<" sep:@"," end:@">" error:&error];
+                [[theValue(success) should] beTrue];
+                [[error should] beNil];
+                NSData *data = [stream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+                [stream close];
+                return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+            };
+
+            it(@"For a nonempty collection", ^{
+                [[writeToMemory(@[@"\u00e9t\u00e9", @(20)]) should] equal:@"<\u00e9t\u00e9,20>"];
+            });
+
+            it(@"For a collection larger than a chunk", ^{
+                NSMutableArray *input = [NSMutableArray array];
+                for (NSUInteger i = 0; i < 50000; ++i) {
+                    [input addObject:@"abcd"];
+                }
+                NSString *expected = [input fnx_mkStringWithStart:@"<" sep:@"," end:@">"];
+                [[writeToMemory(input) should] equal:expected];
+            });
+
+            it(@"For an empty collection", ^{
+                [[writeToMemory(@[]) should] equal:@"<>"];
+            });
+
+        });
         
+        context(@"Should be able to select a range of elements", ^{
+
+            NSArray *input = @[@(10), @(20), @(30), @(40)];
+
+            it(@"For a range within the collection", ^{
+                [[[input fnx_slice:NSMakeRange(1, 2)] should] equal:@[@(20), @(30)]];
+            });
+
+            it(@"For a range that extends past the end of the collection", ^{
+                [[[input fnx_slice:NSMakeRange(2, 10)] should] equal:@[@(30), @(40)]];
+                [[[input fnx_slice:NSMakeRange(10, 10)] should] equal:@[]];
+            });
+
+        });
+
+        context(@"Should be able to take the first or last n elements", ^{
+
+            NSArray *input = @[@(10), @(20), @(30), @(40)];
+
+            it(@"For a nonempty collection", ^{
+                [[[input fnx_take:2] should] equal:@[@(10), @(20)]];
+                [[[input fnx_takeRight:2] should] equal:@[@(30), @(40)]];
+                [[[input fnx_take:10] should] equal:input];
+                [[[input fnx_takeRight:10] should] equal:input];
+            });
+
+            it(@"For an empty collection", ^{
+                [[[@[] fnx_take:2] should] equal:@[]];
+                [[[@[] fnx_takeRight:2] should] equal:@[]];
+            });
+
+        });
+
+        it(@"Should be able to split the collection at a given position", ^{
+            NSArray *input = @[@(10), @(20), @(30), @(40)];
+            FNXTuple2 *result = [input fnx_splitAt:1];
+            [[result._1 should] equal:@[@(10)]];
+            [[result._2 should] equal:@[@(20), @(30), @(40)]];
+        });
+
+        context(@"Should be able to zip collections", ^{
+
+            NSArray *input = @[@(10), @(20), @(30)];
+            NSArray *other = @[@"a", @"b"];
+
+            it(@"Into pairs, as long as the shorter collection", ^{
+                NSArray *result = [input fnx_zip:other];
+                [[result should] equal:@[[FNXTuple2 tuple2With_1:@(10) _2:@"a"],
+                                         [FNXTuple2 tuple2With_1:@(20) _2:@"b"]]];
+                [[[@[] fnx_zip:other] should] equal:@[]];
+            });
+
+            it(@"With their indexes", ^{
+                NSArray *result = [other fnx_zipWithIndex];
+                [[result should] equal:@[[FNXTuple2 tuple2With_1:@"a" _2:@(0)],
+                                         [FNXTuple2 tuple2With_1:@"b" _2:@(1)]]];
+            });
+
+            it(@"With a function, without pairs", ^{
+                NSArray *result = [input fnx_zip:other with:^id(NSNumber *n, NSString *s) {
+                    return [NSString stringWithFormat:@"%@%@", s, n];
+                }];
+                [[result should] equal:@[@"a10", @"b20"]];
+            });
+
+            it(@"And unzip them again", ^{
+                FNXTuple2 *result = [[input fnx_zip:other] fnx_unzip];
+                [[result._1 should] equal:@[@(10), @(20)]];
+                [[result._2 should] equal:other];
+                result = [input.fnx_zipWithIndex fnx_unzip];
+                [[result._2 should] equal:@[@(0), @(1), @(2)]];
+                result = [@[[FNXTuple2 tuple2With_1:@(1) _2:@"x"]] fnx_unzip];
+                [[result._1 should] equal:@[@(1)]];
+                [[result._2 should] equal:@[@"x"]];
+            });
+
+        });
+
+        it(@"Should be able to apply a function to each element and its index", ^{
+            NSMutableArray *result = [NSMutableArray array];
+            [@[@"a", @"b"] fnx_foreachWithIndex:^(NSString *s, NSUInteger idx) {
+                [result addObject:[NSString stringWithFormat:@"%@%lu", s, (unsigned long)idx]];
+            }];
+            [[result should] equal:@[@"a0", @"b1"]];
+        });
+
         context(@"Should be able to convert a collection of FNXTuple2 objects to a dictionary", ^{
             
             it(@"For a nonempty collection", ^{
@@ -249,9 +491,408 @@ describe(@"NSArray+FNXFunctionalExtensions", ^{
             });
             
         });
+
+        context(@"Should be able to fold from the left until told to stop", ^{
+
+            NSArray *input = @[@(10), @(20), @(30), @(40)];
+
+            it(@"Stopping at the element that sets stop", ^{
+                __block NSUInteger calls = 0;
+                NSNumber *result = [input fnx_foldLeftWhileWithStartValue:@(0)
+                                                                       op:^id(NSNumber *acc, NSNumber *n, NSUInteger idx, BOOL *stop) {
+                    calls += 1;
+                    NSNumber *sum = @(acc.intValue + n.intValue);
+                    *stop = sum.intValue >= 30;
+                    return sum;
+                }];
+                [[result should] equal:@(30)];
+                [[theValue(calls) should] equal:@(2)];
+            });
+
+            it(@"Passing the index of each element", ^{
+                NSArray *result = [input fnx_foldLeftWhileWithStartValue:@[]
+                                                                      op:^id(NSArray *acc, id obj, NSUInteger idx, BOOL *stop) {
+                    return [acc arrayByAddingObject:@(idx)];
+                }];
+                [[result should] equal:@[@(0), @(1), @(2), @(3)]];
+            });
+
+            it(@"For an empty collection", ^{
+                id result = [@[] fnx_foldLeftWhileWithStartValue:@(0) op:^id(id acc, id obj, NSUInteger idx, BOOL *stop) {
+                    return obj;
+                }];
+                [[result should] equal:@(0)];
+            });
+
+        });
+
+        context(@"Should be able to produce running accumulations", ^{
+
+            it(@"For a nonempty collection", ^{
+                NSArray *result = [@[@(10), @(20), @(30)] fnx_scanLeftWithStartValue:@(0) op:^id(NSNumber *acc, NSNumber *n) {
+                    return @(acc.intValue + n.intValue);
+                }];
+                [[result should] equal:@[@(0), @(10), @(30), @(60)]];
+            });
+
+            it(@"For an empty collection", ^{
+                NSArray *result = [@[] fnx_scanLeftWithStartValue:@(0) op:^id(id acc, id obj) {
+                    return obj;
+                }];
+                [[result should] equal:@[@(0)]];
+            });
+
+        });
+
+        context(@"Should be able to split elements into windows", ^{
+
+            NSArray *input = @[@(1), @(2), @(3), @(4), @(5), @(6), @(7)];
+
+            it(@"With fixed-size groups", ^{
+                [[[input fnx_grouped:3] should] equal:@[@[@(1), @(2), @(3)], @[@(4), @(5), @(6)], @[@(7)]]];
+                [[[input fnx_grouped:7] should] equal:@[input]];
+                [[[@[] fnx_grouped:3] should] equal:@[]];
+            });
+
+            it(@"With overlapping windows", ^{
+                NSArray *expected = @[@[@(1), @(2), @(3)], @[@(3), @(4), @(5)], @[@(5), @(6), @(7)]];
+                [[[input fnx_sliding:3 step:2] should] equal:expected];
+                [[[input fnx_sliding:6 step:2] should] equal:@[[input fnx_take:6], [input fnx_drop:2]]];
+                [[[input fnx_sliding:10 step:1] should] equal:@[input]];
+            });
+
+            it(@"With gaps between the windows", ^{
+                [[[input fnx_sliding:2 step:3] should] equal:@[@[@(1), @(2)], @[@(4), @(5)], @[@(7)]]];
+                NSArray *six = [input fnx_take:6];
+                [[[six fnx_sliding:2 step:3] should] equal:@[@[@(1), @(2)], @[@(4), @(5)]]];
+                [[[input fnx_sliding:2 step:4] should] equal:@[@[@(1), @(2)], @[@(5), @(6)]]];
+                [[[input fnx_sliding:2 step:4].fnx_toArray should] equal:[input.objectEnumerator fnx_sliding:2 step:4].fnx_toArray];
+                [[[six fnx_sliding:2 step:3].fnx_toArray should] equal:[six.objectEnumerator fnx_sliding:2 step:3].fnx_toArray];
+            });
+
+            it(@"Backed by the original collection", ^{
+                [[[[input fnx_grouped:3][1] class] should] equal:[FNXArraySlice class]];
+            });
+
+            it(@"With a window size or step of zero", ^{
+                [[theBlock(^{
+                    [input fnx_grouped:0];
+                }) should] raiseWithName:NSInvalidArgumentException];
+                [[theBlock(^{
+                    [input fnx_sliding:2 step:0];
+                }) should] raiseWithName:NSInvalidArgumentException];
+            });
+
+        });
+
+        context(@"Should be able to sort elements by a key", ^{
+
+            NSArray *input = @[@"pear", @"fig", @"apple", @"kiwi", @"plum", @"date", @"banana"];
+            id (^length)(NSString *) = ^id(NSString *s) {
+                return @(s.length);
+            };
+
+            it(@"Keeping elements with equal keys in their original order", ^{
+                NSArray *expected = @[@"fig", @"pear", @"kiwi", @"plum", @"date", @"apple", @"banana"];
+                [[[input fnx_sortBy:length] should] equal:expected];
+            });
+
+            it(@"Computing each key once", ^{
+                __block NSUInteger calls = 0;
+                [input fnx_sortBy:^id(NSString *s) {
+                    calls += 1;
+                    return @(s.length);
+                }];
+                [[theValue(calls) should] equal:theValue(input.count)];
+            });
+
+            it(@"For a collection longer than an insertion sort run", ^{
+                NSMutableArray *numbers = [NSMutableArray array];
+                for (NSInteger i = 0; i < 100; ++i) {
+                    [numbers addObject:@((i * 37) % 100)];
+                }
+                NSArray *expected = [numbers sortedArrayUsingSelector:@selector(compare:)];
+                [[[numbers fnx_sortBy:^id(NSNumber *n) {
+                    return n;
+                }] should] equal:expected];
+            });
+
+            it(@"For an empty collection", ^{
+                [[[@[] fnx_sortBy:length] should] equal:@[]];
+            });
+
+        });
+
+        context(@"Should be able to select the elements with the largest keys", ^{
+
+            NSArray *input = @[@"pear", @"fig", @"apple", @"kiwi", @"plum", @"date", @"banana"];
+            id (^length)(NSString *) = ^id(NSString *s) {
+                return @(s.length);
+            };
+
+            it(@"Preferring earlier elements of equal keys", ^{
+                [[[input fnx_topK:3 by:length] should] equal:@[@"banana", @"apple", @"pear"]];
+            });
+
+            it(@"When asked for more elements than there are", ^{
+                NSArray *expected = @[@"banana", @"apple", @"pear", @"kiwi", @"plum", @"date", @"fig"];
+                [[[input fnx_topK:10 by:length] should] equal:expected];
+            });
+
+            it(@"When asked for no elements", ^{
+                [[[input fnx_topK:0 by:length] should] equal:@[]];
+            });
+
+        });
+
+        context(@"Should be able to find the element with the smallest or largest key", ^{
+
+            NSArray *input = @[@"pear", @"fig", @"apple", @"kiwi", @"banana", @"dog"];
+            id (^length)(NSString *) = ^id(NSString *s) {
+                return @(s.length);
+            };
+
+            it(@"For a nonempty collection", ^{
+                [[[input fnx_minBy:length] should] equal:@"fig"];
+                [[[input fnx_maxBy:length] should] equal:@"banana"];
+            });
+
+            it(@"For an empty collection", ^{
+                [[theBlock(^{
+                    [@[] fnx_minBy:length];
+                }) should] raiseWithName:@"FNXUnsupportedOperation"];
+                [[theBlock(^{
+                    [@[] fnx_maxBy:length];
+                }) should] raiseWithName:@"FNXUnsupportedOperation"];
+            });
+
+        });
         
     });
 
+    context(@"Numeric", ^{
+
+        NSArray *input = @[@(2), @(4.0), @(4), @(4), @(5), @(5), @(7), @(9)];
+
+        it(@"Should be able to sum elements as a double", ^{
+            [[theValue(input.fnx_sumDouble) should] equal:theValue(40.0)];
+            [[theValue(@[].fnx_sumDouble) should] equal:theValue(0.0)];
+        });
+
+        it(@"Should be able to find the smallest and largest values", ^{
+            double min = 0.0;
+            double max = 0.0;
+            [input fnx_minMax:&min max:&max];
+            [[theValue(min) should] equal:theValue(2.0)];
+            [[theValue(max) should] equal:theValue(9.0)];
+            [[theBlock(^{
+                double unused;
+                [@[] fnx_minMax:&unused max:&unused];
+            }) should] raise];
+        });
+
+        it(@"Should be able to compute summary statistics", ^{
+            FNXNumericStats stats = input.fnx_stats;
+            [[theValue(stats.count) should] equal:@(8)];
+            [[theValue(stats.sum) should] equal:theValue(40.0)];
+            [[theValue(stats.min) should] equal:theValue(2.0)];
+            [[theValue(stats.max) should] equal:theValue(9.0)];
+            [[theValue(stats.mean) should] equal:theValue(5.0)];
+            [[theValue(stats.variance) should] equal:theValue(4.0)];
+        });
+
+        it(@"Should return the original element as the smallest or largest value", ^{
+            NSNumber *largest = @(1e10);
+            NSArray *numbers = @[@(3), largest, @(-2.5)];
+            [[theValue(numbers.fnx_max == largest) should] beTrue];
+            [[numbers.fnx_min should] equal:@(-2.5)];
+        });
+
+    });
+
+    context(@"Parallel", ^{
+
+        NSMutableArray *large = [NSMutableArray array];
+        for (NSUInteger i = 0; i < 10000; ++i) {
+            [large addObject:@(i)];
+        }
+        NSArray *input = [large copy];
+
+        context(@"Should be able to map elements in parallel, preserving order", ^{
+
+            it(@"With the automatic grain size", ^{
+                NSArray *result = [input fnx_mapParallel:^id(NSNumber *n) {
+                    return @(n.integerValue * 2);
+                }];
+                [[result should] equal:[input fnx_map:^id(NSNumber *n) {
+                    return @(n.integerValue * 2);
+                }]];
+            });
+
+            it(@"With an explicit grain size", ^{
+                NSArray *result = [input fnx_mapParallel:^id(NSNumber *n) {
+                    return @(n.integerValue + 1);
+                } grainSize:7];
+                [[theValue(result.count) should] equal:@(10000)];
+                [[result[0] should] equal:@(1)];
+                [[result.lastObject should] equal:@(10000)];
+            });
+
+            it(@"For an empty collection", ^{
+                NSArray *result = [@[] fnx_mapParallel:^id(id obj) {
+                    return obj;
+                }];
+                [[result should] equal:@[]];
+            });
+
+        });
+
+        it(@"Should be able to apply a function to each element in parallel", ^{
+            __block int64_t sum = 0;
+            NSLock *lock = [[NSLock alloc] init];
+            [input fnx_foreachParallel:^(NSNumber *n) {
+                [lock lock];
+                sum += n.longLongValue;
+                [lock unlock];
+            } grainSize:100];
+            [[theValue(sum) should] equal:theValue((int64_t)(9999 * 10000 / 2))];
+        });
+
+        it(@"Should be able to select elements in parallel, preserving order", ^{
+            NSArray *result = [input fnx_filterParallel:^BOOL(NSNumber *n) {
+                return n.integerValue % 3 == 0;
+            } grainSize:10];
+            [[result should] equal:[input fnx_filter:^BOOL(NSNumber *n) {
+                return n.integerValue % 3 == 0;
+            }]];
+        });
+
+        it(@"Should be able to count elements in parallel", ^{
+            NSUInteger result = [input fnx_countParallel:^BOOL(NSNumber *n) {
+                return n.integerValue % 2 == 0;
+            }];
+            [[theValue(result) should] equal:@(5000)];
+        });
+
+        it(@"Should be able to test predicates in parallel", ^{
+            [[theValue([input fnx_existsParallel:^BOOL(NSNumber *n) {
+                return n.integerValue == 9000;
+            }]) should] beTrue];
+            [[theValue([input fnx_existsParallel:^BOOL(NSNumber *n) {
+                return n.integerValue < 0;
+            }]) should] beFalse];
+            [[theValue([input fnx_forallParallel:^BOOL(NSNumber *n) {
+                return n.integerValue >= 0;
+            }]) should] beTrue];
+            [[theValue([input fnx_forallParallel:^BOOL(NSNumber *n) {
+                return n.integerValue != 42;
+            }]) should] beFalse];
+            [[theValue([@[] fnx_existsParallel:^BOOL(id obj) {
+                return YES;
+            }]) should] beFalse];
+        });
+
+        it(@"Should be able to group elements in parallel, preserving order within each bucket", ^{
+            id (^byRemainder)(id) = ^id (NSNumber *n) {
+                return @(n.integerValue % 7);
+            };
+            NSDictionary *result = [input fnx_groupByParallel:byRemainder];
+            [[result should] equal:[input fnx_groupBy:byRemainder]];
+            [[theValue([@[] fnx_groupByParallel:byRemainder].count) should] equal:@(0)];
+        });
+
+        it(@"Should be able to reduce the buckets of a discriminator function in parallel", ^{
+            NSDictionary *result = [input fnx_groupByParallel:^id(NSNumber *n) {
+                return @(n.integerValue % 2);
+            } reduce:^id(NSNumber *acc, NSNumber *n) {
+                return @(acc.longLongValue + n.longLongValue);
+            }];
+            [[result[@(0)] should] equal:@(4999 * 5000)];
+            [[result[@(1)] should] equal:@(5000 * 5000)];
+        });
+
+        it(@"Should be able to map the elements to a dictionary in parallel, letting later elements win", ^{
+            NSDictionary *result = [input fnx_mapToDictionaryParallel:^FNXTuple2 *(NSNumber *n) {
+                return [FNXTuple2 tuple2With_1:@(n.integerValue % 10) _2:n];
+            }];
+            [[theValue(result.count) should] equal:@(10)];
+            [[result[@(0)] should] equal:@(9990)];
+            [[result[@(9)] should] equal:@(9999)];
+        });
+
+        context(@"Should be able to combine arrays as sets in parallel, preserving order", ^{
+
+            NSArray *evens = [input fnx_filter:^BOOL(NSNumber *n) {
+                return n.intValue % 2 == 0;
+            }];
+            NSArray *doubled = [input arrayByAddingObjectsFromArray:input];
+
+            it(@"With intersect", ^{
+                [[[doubled fnx_intersectParallel:evens] should] equal:[doubled fnx_intersect:evens]];
+            });
+
+            it(@"With diff", ^{
+                [[[doubled fnx_diffParallel:evens] should] equal:[doubled fnx_diff:evens]];
+            });
+
+            it(@"With distinctBy", ^{
+                id (^lastDigit)(NSNumber *) = ^id(NSNumber *n) {
+                    return @(n.intValue % 10);
+                };
+                [[[input fnx_distinctByParallel:lastDigit] should] equal:[input fnx_distinctBy:lastDigit]];
+            });
+
+        });
+
+        context(@"Should be able to reduce elements in parallel", ^{
+
+            it(@"Preserving the order of a non-commutative operator", ^{
+                NSArray *letters = @[@"a", @"b", @"c", @"d", @"e", @"f", @"g"];
+                NSString *result = [letters fnx_reduceParallel:^id(NSString *acc, NSString *s) {
+                    return [acc stringByAppendingString:s];
+                }];
+                [[result should] equal:@"abcdefg"];
+            });
+
+            it(@"For a large collection", ^{
+                NSNumber *result = [input fnx_reduceParallel:^id(NSNumber *acc, NSNumber *n) {
+                    return @(acc.longLongValue + n.longLongValue);
+                }];
+                [[result should] equal:@(9999 * 10000 / 2)];
+            });
+
+            it(@"For an empty collection", ^{
+                [[theBlock(^{
+                    [@[] fnx_reduceParallel:^id(id acc, id obj) {
+                        return acc;
+                    }];
+                }) should] raise];
+            });
+
+        });
+
+        it(@"Should be able to map groups of elements in parallel", ^{
+            NSArray *sums = [input fnx_mapGroupedParallel:1000 fn:^id(NSArray *group) {
+                return [group fnx_foldLeftWithStartValue:@(0) op:^id(NSNumber *acc, NSNumber *n) {
+                    return @(acc.longLongValue + n.longLongValue);
+                }];
+            }];
+            [[theValue(sums.count) should] equal:@(10)];
+            [[sums[0] should] equal:@(999 * 1000 / 2)];
+            [[sums[9] should] equal:@(9999 * 10000 / 2 - 8999 * 9000 / 2)];
+        });
+
+        it(@"Should be able to sort elements by a key in parallel, keeping elements with equal keys in order", ^{
+            id (^byRemainder)(NSNumber *) = ^id(NSNumber *n) {
+                return @(n.intValue % 7);
+            };
+            NSArray *reversed = input.reverseObjectEnumerator.allObjects;
+            [[[reversed fnx_sortByParallel:byRemainder] should] equal:[reversed fnx_sortBy:byRemainder]];
+            [[[@[] fnx_sortByParallel:byRemainder] should] equal:@[]];
+        });
+
+    });
+
     context(@"<FNXTraversable>", ^{
         
         context(@"Should be able to return the count of items fulfilling a predicate", ^{
@@ -801,6 +1442,17 @@ describe(@"NSArray+FNXFunctionalExtensions", ^{
                     NSNumber *sum = [input fnx_sum];
                     [[theValue(sum.floatValue) should] equal:@(31.1f)];
                 });
+                it(@"of integers whose sum overflows 64 bits", ^{
+                    NSArray *input = @[@(INT64_MAX), @(1)];
+                    NSNumber *sum = [input fnx_sum];
+                    [[sum.stringValue should] equal:@"9223372036854775808"];
+                });
+                it(@"of decimal numbers", ^{
+                    NSArray *input = @[[NSDecimalNumber decimalNumberWithString:@"0.1"],
+                                       [NSDecimalNumber decimalNumberWithString:@"0.2"]];
+                    NSNumber *sum = [input fnx_sum];
+                    [[sum should] equal:[NSDecimalNumber decimalNumberWithString:@"0.3"]];
+                });
             });
             
             it(@"For an empty collection", ^{
@@ -0,0 +1,122 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+
+
+SPEC_BEGIN(NSDictionaryFNXFunctionalExtensionsSpec)
+
+describe(@"NSDictionary+FNXFunctionalExtensions", ^{
+
+    NSDictionary *input = @{ @"a": @(1), @"b": @(2), @"c": @(3), @"d": @(4) };
+    NSDictionary *empty = @{};
+
+    context(@"NSDictionary", ^{
+
+        it(@"Should be able to map values, keeping the keys", ^{
+            NSDictionary *result = [input fnx_mapValues:^id(NSString *key, NSNumber *value) {
+                return [key stringByAppendingString:value.stringValue];
+            }];
+            [[result should] equal:@{ @"a": @"a1", @"b": @"b2", @"c": @"c3", @"d": @"d4" }];
+            [[[empty fnx_mapValues:^id(id key, id value) { return value; }] should] equal:@{}];
+        });
+
+        it(@"Should be able to select entries by key", ^{
+            NSDictionary *result = [input fnx_filterKeys:^BOOL(NSString *key) {
+                return [key compare:@"c"] == NSOrderedAscending;
+            }];
+            [[result should] equal:@{ @"a": @(1), @"b": @(2) }];
+        });
+
+        it(@"Should be able to select entries by key and value", ^{
+            NSDictionary *result = [input fnx_filterEntries:^BOOL(NSString *key, NSNumber *value) {
+                return [key isEqualToString:@"a"] || value.intValue % 2 == 0;
+            }];
+            [[result should] equal:@{ @"a": @(1), @"b": @(2), @"d": @(4) }];
+            [[[empty fnx_filterEntries:^BOOL(id key, id value) { return YES; }] should] equal:@{}];
+        });
+
+        it(@"Should be able to fold over the entries", ^{
+            NSNumber *result = [input fnx_foldEntriesWithStartValue:@(0) op:^id(NSNumber *acc, NSString *key, NSNumber *value) {
+                return @(acc.intValue + value.intValue);
+            }];
+            [[result should] equal:@(10)];
+            [[[empty fnx_foldEntriesWithStartValue:@(0) op:^id(id acc, id key, id value) { return value; }] should] equal:@(0)];
+        });
+
+        it(@"Should be able to apply a function to each entry", ^{
+            NSMutableDictionary *visited = [NSMutableDictionary dictionary];
+            [input fnx_foreachEntry:^(id key, id value) {
+                visited[key] = value;
+            }];
+            [[visited should] equal:input];
+        });
+
+        it(@"Should be able to map keys to pairs and build a dictionary", ^{
+            NSDictionary *result = [input fnx_map:^id(NSString *key) {
+                return [FNXTuple2 tuple2With_1:key.uppercaseString _2:input[key]];
+            }];
+            [[result should] equal:@{ @"A": @(1), @"B": @(2), @"C": @(3), @"D": @(4) }];
+        });
+
+        it(@"Should be able to map keys to an array when the results aren't pairs", ^{
+            NSArray *result = [input fnx_map:^id(NSString *key) {
+                return key.uppercaseString;
+            }];
+            [[[result sortedArrayUsingSelector:@selector(compare:)] should] equal:@[@"A", @"B", @"C", @"D"]];
+        });
+
+    });
+
+    context(@"Parallel", ^{
+
+        NSMutableDictionary *large = [NSMutableDictionary dictionary];
+        for (NSUInteger i = 0; i < 10000; ++i) {
+            large[@(i)] = @(i * 2);
+        }
+
+        it(@"Should be able to map values in parallel", ^{
+            id (^increment)(id, NSNumber *) = ^id(id key, NSNumber *value) {
+                return @(value.intValue + 1);
+            };
+            [[[large fnx_mapValuesParallel:increment] should] equal:[large fnx_mapValues:increment]];
+        });
+
+        it(@"Should be able to select entries in parallel", ^{
+            BOOL (^byKey)(NSNumber *, id) = ^BOOL(NSNumber *key, id value) {
+                return key.intValue % 3 == 0;
+            };
+            NSDictionary *result = [large fnx_filterEntriesParallel:byKey];
+            [[theValue(result.count) should] equal:@(3334)];
+            [[result should] equal:[large fnx_filterEntries:byKey]];
+        });
+
+        it(@"Should be able to apply a function to each entry in parallel", ^{
+            __block int64_t sum = 0;
+            NSLock *lock = [[NSLock alloc] init];
+            [large fnx_foreachEntryParallel:^(NSNumber *key, NSNumber *value) {
+                [lock lock];
+                sum += value.longLongValue;
+                [lock unlock];
+            }];
+            [[theValue(sum) should] equal:theValue((int64_t)9999 * 10000)];
+        });
+
+    });
+
+});
+
+SPEC_END
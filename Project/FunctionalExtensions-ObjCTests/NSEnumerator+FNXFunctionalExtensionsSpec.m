@@ -0,0 +1,219 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import "FNXMockNaturalsEnumerator.h"
+
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+
+
+SPEC_BEGIN(NSEnumerator_FNXFunctionalExtensionsSpec)
+
+describe(@"NSEnumerator+FNXFunctionalExtensions", ^{
+
+    NSArray *input = @[@(10), @(20), @(30), @(40)];
+
+    context(@"Lazy transformers", ^{
+
+        it(@"Should run over an unbounded source without draining it", ^{
+            FNXMockNaturalsEnumerator *naturals = [FNXMockNaturalsEnumerator mockNaturalsEnumerator];
+            NSEnumerator *evens = [[naturals fnx_filter:^BOOL(NSNumber *n) {
+                return n.intValue % 2 == 0;
+            }] fnx_map:^id(NSNumber *n) {
+                return @(n.intValue * 10);
+            }];
+            NSArray *result = [[evens fnx_take:3] fnx_toArray];
+            [[result should] equal:@[@(0), @(20), @(40)]];
+            [[theValue(naturals.pulled) should] equal:@(5)];
+        });
+
+        it(@"Should support fast enumeration", ^{
+            NSMutableArray *result = [NSMutableArray array];
+            for (id obj in [[FNXMockNaturalsEnumerator mockNaturalsEnumerator] fnx_take:40]) {
+                [result addObject:obj];
+            }
+            [[theValue(result.count) should] equal:@(40)];
+            [[result.lastObject should] equal:@(39)];
+        });
+
+        it(@"Should not pull elements past the one a short-circuiting terminal stops at", ^{
+            FNXMockNaturalsEnumerator *naturals = [FNXMockNaturalsEnumerator mockNaturalsEnumerator];
+            __block NSUInteger mapped = 0;
+            NSEnumerator *tens = [naturals fnx_map:^id(NSNumber *n) {
+                mapped += 1;
+                return @(n.intValue * 10);
+            }];
+            id<FNXOption> found = [tens fnx_find:^BOOL(NSNumber *n) {
+                return n.intValue == 30;
+            }];
+            [[found.fnx_get should] equal:@(30)];
+            [[theValue(naturals.pulled) should] equal:@(4)];
+            [[theValue(mapped) should] equal:@(4)];
+
+            [[[tens fnx_findValue:^BOOL(NSNumber *n) {
+                return n.intValue == 50;
+            }] should] equal:@(50)];
+            [[theValue([tens fnx_exists:^BOOL(NSNumber *n) {
+                return n.intValue == 70;
+            }]) should] beYes];
+            [[theValue([tens fnx_forall:^BOOL(NSNumber *n) {
+                return n.intValue < 90;
+            }]) should] beNo];
+            [[tens.fnx_headOption.fnx_get should] equal:@(100)];
+            [[theValue(naturals.pulled) should] equal:@(11)];
+            [[theValue(mapped) should] equal:@(11)];
+        });
+
+        it(@"Should drop elements", ^{
+            [[[input.objectEnumerator fnx_drop:2].fnx_toArray should] equal:@[@(30), @(40)]];
+            [[[input.objectEnumerator fnx_drop:10].fnx_toArray should] equal:@[]];
+            [[input.objectEnumerator.fnx_tail.fnx_toArray should] equal:@[@(20), @(30), @(40)]];
+        });
+
+        it(@"Should select all the elements except the last one", ^{
+            [[input.objectEnumerator.fnx_init.fnx_toArray should] equal:@[@(10), @(20), @(30)]];
+            [[@[].objectEnumerator.fnx_init.fnx_toArray should] equal:@[]];
+        });
+
+        it(@"Should select elements that don't satisfy a predicate", ^{
+            NSEnumerator *result = [input.objectEnumerator fnx_filterNot:^BOOL(NSNumber *n) {
+                return n.intValue % 20 == 0;
+            }];
+            [[result.fnx_toArray should] equal:@[@(10), @(30)]];
+        });
+
+        it(@"Should flatten the results of flatMap", ^{
+            NSEnumerator *result = [input.objectEnumerator fnx_flatMap:^id<FNXTraversableOnce>(NSNumber *n) {
+                if (n.intValue < 30) {
+                    return @[n, n];
+                } else {
+                    return [NSNull fnx_none];
+                }
+            }];
+            [[result.fnx_toArray should] equal:@[@(10), @(10), @(20), @(20)]];
+        });
+
+        it(@"Should zip with another enumerator", ^{
+            NSArray *result = [[input.objectEnumerator fnx_zip:[FNXMockNaturalsEnumerator mockNaturalsEnumerator]] fnx_toArray];
+            [[theValue(result.count) should] equal:@(4)];
+            FNXTuple2 *last = result.lastObject;
+            [[last._1 should] equal:@(40)];
+            [[last._2 should] equal:@(3)];
+        });
+
+        it(@"Should group elements without draining the source", ^{
+            FNXMockNaturalsEnumerator *naturals = [FNXMockNaturalsEnumerator mockNaturalsEnumerator];
+            NSArray *result = [[naturals fnx_grouped:3] fnx_take:2].fnx_toArray;
+            [[result should] equal:@[@[@(0), @(1), @(2)], @[@(3), @(4), @(5)]]];
+            [[theValue(naturals.pulled) should] equal:@(6)];
+            [[[input.objectEnumerator fnx_grouped:3].fnx_toArray should] equal:@[@[@(10), @(20), @(30)], @[@(40)]]];
+        });
+
+        it(@"Should produce sliding windows", ^{
+            NSArray *numbers = @[@(1), @(2), @(3), @(4), @(5), @(6), @(7)];
+            NSArray *overlapping = [numbers.objectEnumerator fnx_sliding:3 step:2].fnx_toArray;
+            [[overlapping should] equal:[numbers fnx_sliding:3 step:2]];
+            NSArray *gapped = [numbers.objectEnumerator fnx_sliding:2 step:3].fnx_toArray;
+            [[gapped should] equal:[numbers fnx_sliding:2 step:3]];
+            [[[@[].objectEnumerator fnx_sliding:2 step:1].fnx_toArray should] equal:@[]];
+        });
+
+        it(@"Should produce running accumulations without draining the source", ^{
+            FNXMockNaturalsEnumerator *naturals = [FNXMockNaturalsEnumerator mockNaturalsEnumerator];
+            NSEnumerator *sums = [naturals fnx_scanLeftWithStartValue:@(0) op:^id(NSNumber *acc, NSNumber *n) {
+                return @(acc.intValue + n.intValue);
+            }];
+            [[[sums fnx_take:5].fnx_toArray should] equal:@[@(0), @(0), @(1), @(3), @(6)]];
+            [[theValue(naturals.pulled) should] equal:@(4)];
+            NSEnumerator *empty = [@[].objectEnumerator fnx_scanLeftWithStartValue:@(0) op:^id(id acc, id obj) {
+                return acc;
+            }];
+            [[empty.fnx_toArray should] equal:@[@(0)]];
+        });
+
+        it(@"Should pipe elements through workers in order", ^{
+            NSMutableArray *numbers = [NSMutableArray array];
+            for (NSUInteger i = 0; i < 1000; ++i) {
+                [numbers addObject:@(i)];
+            }
+            NSEnumerator *doubled = [numbers.objectEnumerator fnx_pipe:^id(NSNumber *n) {
+                return @(n.intValue * 2);
+            } workers:4 bufferSize:16];
+            [[doubled.fnx_toArray should] equal:[numbers fnx_map:^id(NSNumber *n) {
+                return @(n.intValue * 2);
+            }]];
+            [[[@[].objectEnumerator fnx_pipe:^id(id obj) {
+                return obj;
+            } workers:2 bufferSize:4].fnx_toArray should] equal:@[]];
+        });
+
+        it(@"Should not read further ahead of the consumer than the buffer", ^{
+            FNXMockNaturalsEnumerator *naturals = [FNXMockNaturalsEnumerator mockNaturalsEnumerator];
+            NSEnumerator *piped = [naturals fnx_pipe:^id(NSNumber *n) {
+                return n;
+            } workers:2 bufferSize:16];
+            NSMutableArray *result = [NSMutableArray array];
+            for (NSUInteger i = 0; i < 10; ++i) {
+                [result addObject:piped.nextObject];
+            }
+            [[result should] equal:@[@0, @1, @2, @3, @4, @5, @6, @7, @8, @9]];
+            usleep(50000);
+            [[theValue(naturals.pulled <= 10 + 16) should] beYes];
+            [[theBlock(^{
+                [naturals fnx_pipe:^id(id obj) {
+                    return obj;
+                } workers:0 bufferSize:16];
+            }) should] raiseWithName:NSInvalidArgumentException];
+        });
+
+    });
+
+    context(@"<FNXTraversable>", ^{
+
+        it(@"Should stop folding without consuming further elements", ^{
+            FNXMockNaturalsEnumerator *naturals = [FNXMockNaturalsEnumerator mockNaturalsEnumerator];
+            NSNumber *result = [naturals fnx_foldLeftWhileWithStartValue:@(0)
+                                                                      op:^id(NSNumber *acc, NSNumber *n, NSUInteger idx, BOOL *stop) {
+                *stop = (idx == 4);
+                return @(acc.intValue + n.intValue);
+            }];
+            [[result should] equal:@(10)];
+            [[theValue(naturals.pulled) should] equal:@(5)];
+        });
+
+        it(@"Should return the first element without draining the source", ^{
+            FNXMockNaturalsEnumerator *naturals = [FNXMockNaturalsEnumerator mockNaturalsEnumerator];
+            [[naturals.fnx_head should] equal:@(0)];
+            [[naturals.fnx_headOption.fnx_get should] equal:@(1)];
+            [[theBlock(^{
+                [@[].objectEnumerator fnx_head];
+            }) should] raise];
+        });
+
+        it(@"Should return the last element", ^{
+            [[input.objectEnumerator.fnx_last should] equal:@(40)];
+            [[theValue(@[].objectEnumerator.fnx_lastOption.fnx_isEmpty) should] beTrue];
+        });
+
+        it(@"Should count its elements", ^{
+            [[theValue(input.objectEnumerator.fnx_size) should] equal:@(4)];
+        });
+
+    });
+
+});
+
+SPEC_END
@@ -40,6 +40,54 @@ describe(@"NSOrderedSet+FNXFunctionalExtensions", ^{
             });
             
         });
+
+        context(@"Should be able to flatten the results of a function into an ordered set", ^{
+
+            it(@"For collections returned by the function", ^{
+                NSOrderedSet *input = [NSOrderedSet orderedSetWithArray:@[@(10), @(20), @(30)]];
+                NSOrderedSet *result = [input fnx_flatMap:^id<FNXTraversableOnce>(NSNumber *n) {
+                    return @[n, @(n.intValue + 10)];
+                }];
+                NSOrderedSet *expected = [NSOrderedSet orderedSetWithArray:@[@(10), @(20), @(30), @(40)]];
+                [[result should] equal:expected];
+            });
+
+            it(@"For options returned by the function", ^{
+                NSOrderedSet *input = [NSOrderedSet orderedSetWithArray:@[@(10), @(20), @(30)]];
+                NSOrderedSet *result = [input fnx_flatMap:^id<FNXTraversableOnce>(NSNumber *n) {
+                    if (n.intValue > 15) {
+                        return [FNXSome someWithValue:n];
+                    } else {
+                        return [NSNull fnx_none];
+                    }
+                }];
+                NSOrderedSet *expected = [NSOrderedSet orderedSetWithArray:@[@(20), @(30)]];
+                [[result should] equal:expected];
+            });
+
+            it(@"For an empty collection", ^{
+                NSOrderedSet *result = [empty fnx_flatMap:^id<FNXTraversableOnce>(id obj) {
+                    return @[obj];
+                }];
+                [[result should] equal:empty];
+            });
+
+        });
+
+        it(@"Should be able to zip elements with their indexes", ^{
+            NSOrderedSet *input = [NSOrderedSet orderedSetWithArray:@[@"a", @"b"]];
+            [[input.fnx_zipWithIndex should] equal:@[[FNXTuple2 tuple2With_1:@"a" _2:@(0)],
+                                                     [FNXTuple2 tuple2With_1:@"b" _2:@(1)]]];
+        });
+
+        it(@"Should be able to map elements to an ordered set, keeping equal results once", ^{
+            NSOrderedSet *input = [NSOrderedSet orderedSetWithArray:@[@(10), @(25), @(20), @(35)]];
+            NSOrderedSet *result = [input fnx_mapToOrderedSet:^id(NSNumber *n) {
+                return @(n.intValue / 10);
+            }];
+            NSOrderedSet *expected = [NSOrderedSet orderedSetWithArray:@[@(1), @(2), @(3)]];
+            [[result should] equal:expected];
+        });
     });
     
     context(@"<FNXTraversable>", ^{
@@ -0,0 +1,103 @@
+/********************************************************************
+ * (C) Copyright 2013 by Autodesk, Inc. All Rights Reserved. By using
+ * this code,  you  are  agreeing  to the terms and conditions of the
+ * License  Agreement  included  in  the documentation for this code.
+ * AUTODESK  MAKES  NO  WARRANTIES,  EXPRESS  OR  IMPLIED,  AS TO THE
+ * CORRECTNESS OF THIS CODE OR ANY DERIVATIVE WORKS WHICH INCORPORATE
+ * IT.  AUTODESK PROVIDES THE CODE ON AN 'AS-IS' BASIS AND EXPLICITLY
+ * DISCLAIMS  ANY  LIABILITY,  INCLUDING CONSEQUENTIAL AND INCIDENTAL
+ * DAMAGES  FOR ERRORS, OMISSIONS, AND  OTHER  PROBLEMS IN THE  CODE.
+ *
+ * Use, duplication,  or disclosure by the U.S. Government is subject
+ * to  restrictions  set forth  in FAR 52.227-19 (Commercial Computer
+ * Software Restricted Rights) as well as DFAR 252.227-7013(c)(1)(ii)
+ * (Rights  in Technical Data and Computer Software),  as applicable.
+ *******************************************************************/
+
+#import <Kiwi/Kiwi.h>
+#import <FunctionalExtensions-ObjC/FunctionalExtensions.h>
+
+
+SPEC_BEGIN(NSSetFNXFunctionalExtensionsSpec)
+
+describe(@"NSSet+FNXFunctionalExtensions", ^{
+
+    NSSet *input = [NSSet setWithArray:@[@(10), @(20), @(30), @(40)]];
+    NSSet *empty = [NSSet set];
+
+    context(@"NSSet", ^{
+
+        it(@"Should be able to partition elements based on a discriminator function", ^{
+            NSDictionary *result = [input fnx_groupBy:^id(NSNumber *n) {
+                return @(n.intValue > 25);
+            }];
+            NSDictionary *expected = @{ @NO: [NSSet setWithArray:@[@(10), @(20)]],
+                                        @YES: [NSSet setWithArray:@[@(30), @(40)]] };
+            [[result should] equal:expected];
+            [[[empty fnx_groupBy:^id(id obj) { return obj; }] should] equal:@{}];
+        });
+
+        it(@"Should be able to map elements to a set, keeping equal results once", ^{
+            NSSet *result = [input fnx_mapToSet:^id(NSNumber *n) {
+                return @(n.intValue / 20);
+            }];
+            [[result should] equal:[NSSet setWithArray:@[@(0), @(1), @(2)]]];
+        });
+
+        it(@"Should be able to partition elements in two sets according to a predicate", ^{
+            FNXTuple2 *result = [input fnx_partition:^BOOL(NSNumber *n) {
+                return n.intValue % 20 == 0;
+            }];
+            [[result._1 should] equal:[NSSet setWithArray:@[@(20), @(40)]]];
+            [[result._2 should] equal:[NSSet setWithArray:@[@(10), @(30)]]];
+        });
+
+    });
+
+    context(@"<FNXTraversable>", ^{
+
+        it(@"Should select elements into sets", ^{
+            NSSet *result = [input fnx_filter:^BOOL(NSNumber *n) {
+                return n.intValue > 15;
+            }];
+            [[result should] equal:[NSSet setWithArray:@[@(20), @(30), @(40)]]];
+            result = [input fnx_filterNot:^BOOL(NSNumber *n) {
+                return n.intValue > 15;
+            }];
+            [[result should] equal:[NSSet setWithArray:@[@(10)]]];
+        });
+
+        it(@"Should agree on the order of the elements", ^{
+            NSArray *ordered = input.fnx_toArray;
+            [[input.fnx_head should] equal:ordered.firstObject];
+            [[input.fnx_last should] equal:ordered.lastObject];
+            [[input.fnx_headOption.fnx_get should] equal:ordered.firstObject];
+            [[input.fnx_lastOption.fnx_get should] equal:ordered.lastObject];
+            [[input.fnx_tail should] equal:[NSSet setWithArray:[ordered fnx_drop:1]]];
+            [[input.fnx_init should] equal:[NSSet setWithArray:[ordered fnx_dropRight:1]]];
+            [[[input fnx_drop:2] should] equal:[NSSet setWithArray:[ordered fnx_drop:2]]];
+        });
+
+        it(@"Should handle an empty set", ^{
+            [[theValue(empty.fnx_headOption.fnx_isEmpty) should] beTrue];
+            [[theValue(empty.fnx_lastOption.fnx_isEmpty) should] beTrue];
+            [[[empty fnx_drop:1] should] equal:empty];
+            [[theBlock(^{
+                [empty fnx_head];
+            }) should] raise];
+            [[theBlock(^{
+                [empty fnx_last];
+            }) should] raise];
+            [[theBlock(^{
+                [empty fnx_tail];
+            }) should] raise];
+            [[theBlock(^{
+                [empty fnx_init];
+            }) should] raise];
+        });
+
+    });
+
+});
+
+SPEC_END